@@ -0,0 +1,917 @@
+/*	$OpenBSD$	*/
+
+/*
+ * Copyright (c) 2019 Reyk Floeter <reyk@openbsd.org>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Microbenchmark of the HPACK encoder, decoder, and Huffman code.
+ *
+ * Each story is a sequence of header blocks that share a dynamic
+ * table, loaded from the hex wire format of the hpack-test-case
+ * stories and the regress samples.  The "cold" variants start every
+ * pass over a story with a new table, like a new connection, while the
+ * "warm" variants keep the table of a long-lived connection.
+ */
+
+#include <sys/types.h>
+#include <sys/queue.h>
+#include <sys/stat.h>
+
+#include <fnmatch.h>
+#include <fts.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <ctype.h>
+#include <err.h>
+
+#include "hpack.h"
+#include "extern.h"
+
+struct block {
+	unsigned char			*b_wire;
+	size_t				 b_wirelen;
+	struct hpack_headerblock	*b_hdrs;
+};
+
+struct story {
+	char				*s_name;
+	struct block			*s_blocks;
+	size_t				 s_nblocks;
+	size_t				 s_table_size;
+};
+
+struct sample {
+	unsigned char			*hs_data;
+	size_t				 hs_len;
+	unsigned char			*hs_huffman;
+	size_t				 hs_huffman_len;
+};
+
+struct result {
+	const char			*r_op;
+	const char			*r_variant;
+	size_t				 r_count;	/* headers or strings */
+	size_t				 r_bytes;	/* input bytes */
+	uint64_t			 r_nsec;
+	uint64_t			 r_allocs;
+};
+
+/* Decoding into headers, a callback, or fields with lazy values */
+enum bench_mode {
+	BENCH_HEADERS,
+	BENCH_CALLBACK,
+	BENCH_VALIDATE,
+	BENCH_LAZY
+};
+
+__dead void	 usage(void);
+
+static int	 load_dir(char *[]);
+static int	 load_hex(const char *);
+static int	 load_json(const char *);
+static int	 load_raw(const char *);
+static int	 load_sample(const char *);
+static int	 add_story(const char *, size_t);
+static int	 add_block(struct story *, unsigned char *, size_t);
+static int	 add_sample(const unsigned char *, size_t);
+static ssize_t	 parsehex(const char *, unsigned char **);
+
+static void	 bench_decode(struct result *, int, enum bench_mode);
+static int	 bench_field(const struct hpack_field *, void *);
+static void	 bench_encode(struct result *, int, int);
+static void	 bench_relay(struct result *, int);
+static void	 bench_huffman_decode(struct result *);
+static void	 bench_huffman_encode(struct result *);
+static void	 bench_print(struct result *);
+
+static uint64_t	 now(void);
+static void	*bench_malloc(size_t, void *);
+static void	*bench_realloc(void *, size_t, void *);
+static void	 bench_free(void *, void *);
+
+static struct story	*stories;
+static size_t		 nstories;
+static struct sample	*samples;
+static size_t		 nsamples;
+static size_t		 passes = 100;
+static int		 machine;
+
+/*
+ * Count the allocations of the library with the allocator hooks.
+ * The buffers that are returned by hpack_encode() and the Huffman
+ * functions always use malloc(3) and are not counted.
+ */
+static uint64_t		 allocs;
+static const struct hpack_allocator bench_allocator = {
+	bench_malloc,
+	bench_realloc,
+	bench_free,
+	&allocs,
+	0
+};
+
+static void *
+bench_malloc(size_t size, void *arg)
+{
+	uint64_t	*count = arg;
+
+	(*count)++;
+	return (malloc(size));
+}
+
+static void *
+bench_realloc(void *ptr, size_t size, void *arg)
+{
+	uint64_t	*count = arg;
+
+	(*count)++;
+	return (realloc(ptr, size));
+}
+
+static void
+bench_free(void *ptr, void *arg)
+{
+	free(ptr);
+}
+
+static uint64_t
+now(void)
+{
+	struct timespec	 ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == -1)
+		err(1, "clock_gettime");
+	return ((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+static ssize_t
+parsehex(const char *hex, unsigned char **bufp)
+{
+	unsigned char	*buf;
+	size_t		 len, i;
+	char		 ss[3];
+
+	if (strncmp(hex, "0x", 2) == 0)
+		hex += 2;
+	if ((len = strlen(hex) / 2) == 0 || (buf = malloc(len)) == NULL)
+		return (-1);
+
+	ss[2] = '\0';
+	for (i = 0; i < len; i++) {
+		ss[0] = hex[i * 2];
+		ss[1] = hex[i * 2 + 1];
+		if (!isxdigit((unsigned char)ss[0]) ||
+		    !isxdigit((unsigned char)ss[1])) {
+			free(buf);
+			return (-1);
+		}
+		buf[i] = (unsigned char)strtoul(ss, NULL, 16);
+	}
+	*bufp = buf;
+
+	return ((ssize_t)len);
+}
+
+static int
+add_story(const char *name, size_t table_size)
+{
+	struct story	*s;
+
+	if ((s = reallocarray(stories, nstories + 1, sizeof(*s))) == NULL)
+		return (-1);
+	stories = s;
+	s = &stories[nstories];
+	memset(s, 0, sizeof(*s));
+	if ((s->s_name = strdup(name)) == NULL)
+		return (-1);
+	s->s_table_size = table_size;
+	nstories++;
+
+	return (0);
+}
+
+static int
+add_block(struct story *s, unsigned char *wire, size_t len)
+{
+	struct block	*b;
+
+	if ((b = reallocarray(s->s_blocks,
+	    s->s_nblocks + 1, sizeof(*b))) == NULL)
+		return (-1);
+	s->s_blocks = b;
+	b = &s->s_blocks[s->s_nblocks++];
+	b->b_wire = wire;
+	b->b_wirelen = len;
+	b->b_hdrs = NULL;
+
+	return (0);
+}
+
+static int
+add_sample(const unsigned char *data, size_t len)
+{
+	struct sample	*hs;
+
+	if ((hs = reallocarray(samples,
+	    nsamples + 1, sizeof(*hs))) == NULL)
+		return (-1);
+	samples = hs;
+	hs = &samples[nsamples];
+	if ((hs->hs_data = malloc(len == 0 ? 1 : len)) == NULL)
+		return (-1);
+	memcpy(hs->hs_data, data, len);
+	hs->hs_len = len;
+	if ((hs->hs_huffman = hpack_huffman_encode(hs->hs_data,
+	    len, &hs->hs_huffman_len)) == NULL)
+		return (-1);
+	nsamples++;
+
+	return (0);
+}
+
+static int
+load_hex(const char *name)
+{
+	struct story	*s;
+	FILE		*fp;
+	char		 buf[BUFSIZ];
+	unsigned char	*wire;
+	ssize_t		 len;
+	int		 ret = -1;
+
+	if ((fp = fopen(name, "r")) == NULL)
+		return (-1);
+	if (add_story(name, 0) == -1)
+		goto done;
+	s = &stories[nstories - 1];
+
+	while (fgets(buf, sizeof(buf), fp) != NULL) {
+		buf[strcspn(buf, "\r\n")] = '\0';
+		if ((len = parsehex(buf, &wire)) == -1)
+			goto done;
+		if (add_block(s, wire, len) == -1) {
+			free(wire);
+			goto done;
+		}
+	}
+
+	ret = 0;
+ done:
+	fclose(fp);
+	return (ret);
+}
+
+static int
+load_json(const char *name)
+{
+	struct story	*s;
+	struct jsmnn	*json = NULL, *cases, *obj;
+	struct stat	 st;
+	FILE		*fp;
+	char		*str = NULL, *wire, *tblsz;
+	unsigned char	*data;
+	const char	*errstr;
+	size_t		 i, table_size = 0;
+	ssize_t		 len;
+	int		 ret = -1;
+
+	if ((fp = fopen(name, "r")) == NULL)
+		return (-1);
+	if (fstat(fileno(fp), &st) == -1 ||
+	    (str = malloc(st.st_size)) == NULL ||
+	    (off_t)fread(str, 1, st.st_size, fp) != st.st_size)
+		goto done;
+	if ((json = json_parse(str, st.st_size)) == NULL ||
+	    (cases = json_getarray(json, "cases")) == NULL)
+		goto done;
+	if (add_story(name, 0) == -1)
+		goto done;
+	s = &stories[nstories - 1];
+
+	for (i = 0; i < cases->fields; i++) {
+		if ((obj = json_getarrayobj(cases->d.array[i])) == NULL)
+			continue;
+		if ((tblsz = json_getstr(obj, "header_table_size")) != NULL) {
+			table_size = strtonum(tblsz, 0, LONG_MAX, &errstr);
+			free(tblsz);
+			if (errstr != NULL)
+				goto done;
+			if (table_size > s->s_table_size)
+				s->s_table_size = table_size;
+		}
+		if ((wire = json_getstr(obj, "wire")) == NULL)
+			continue;
+		len = parsehex(wire, &data);
+		free(wire);
+		if (len == -1)
+			goto done;
+		if (add_block(s, data, len) == -1) {
+			free(data);
+			goto done;
+		}
+	}
+
+	ret = 0;
+ done:
+	json_free(json);
+	free(str);
+	fclose(fp);
+	return (ret);
+}
+
+static int
+load_raw(const char *name)
+{
+	FILE		*fp;
+	unsigned char	*wire;
+	size_t		 len;
+	int		 ret = -1;
+
+	if ((fp = fopen(name, "r")) == NULL)
+		return (-1);
+	if ((wire = malloc(UINT16_MAX)) == NULL)
+		goto done;
+	if ((len = fread(wire, 1, UINT16_MAX, fp)) < 1) {
+		free(wire);
+		goto done;
+	}
+	if (add_story(name, 0) == -1 ||
+	    add_block(&stories[nstories - 1], wire, len) == -1) {
+		free(wire);
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	fclose(fp);
+	return (ret);
+}
+
+static int
+load_sample(const char *name)
+{
+	FILE		*fp;
+	unsigned char	 buf[UINT16_MAX];
+	size_t		 len;
+	int		 ret = -1;
+
+	if ((fp = fopen(name, "r")) == NULL)
+		return (-1);
+	if ((len = fread(buf, 1, sizeof(buf), fp)) > 0 &&
+	    add_sample(buf, len) == -1)
+		goto done;
+
+	ret = 0;
+ done:
+	fclose(fp);
+	return (ret);
+}
+
+static int
+load_dir(char *argv[])
+{
+	FTS		*fts;
+	FTSENT		*ftsp;
+	struct story	*s;
+	struct hpack_table *hpack;
+	struct hpack_header *hdr;
+	size_t		 i, j;
+	int		 ret;
+
+	if ((fts = fts_open(argv, FTS_COMFOLLOW|FTS_NOCHDIR, NULL)) == NULL)
+		return (-1);
+
+	while ((ftsp = fts_read(fts)) != NULL) {
+		if (ftsp->fts_info != FTS_F)
+			continue;
+		if (fnmatch("*.hpacktest", ftsp->fts_name,
+		    FNM_PATHNAME) != FNM_NOMATCH)
+			ret = load_hex(ftsp->fts_accpath);
+		else if (fnmatch("*.hpackraw", ftsp->fts_name,
+		    FNM_PATHNAME) != FNM_NOMATCH)
+			ret = load_raw(ftsp->fts_accpath);
+		else if (fnmatch("story_*.json", ftsp->fts_name,
+		    FNM_PATHNAME) != FNM_NOMATCH)
+			ret = load_json(ftsp->fts_accpath);
+		else if (fnmatch("headers_??.txt", ftsp->fts_name,
+		    FNM_PATHNAME) != FNM_NOMATCH)
+			ret = load_sample(ftsp->fts_accpath);
+		else
+			continue;
+		if (ret == -1)
+			errx(1, "%s: failed to load", ftsp->fts_path);
+	}
+	fts_close(fts);
+
+	/* Decode the stories once to get the headers for the encoder */
+	for (i = 0; i < nstories; i++) {
+		s = &stories[i];
+		if ((hpack = hpack_table_new(s->s_table_size)) == NULL)
+			return (-1);
+		for (j = 0; j < s->s_nblocks; j++) {
+			if ((s->s_blocks[j].b_hdrs = hpack_decode(
+			    s->s_blocks[j].b_wire, s->s_blocks[j].b_wirelen,
+			    hpack)) == NULL)
+				errx(1, "%s: failed to decode block %zu",
+				    s->s_name, j);
+			TAILQ_FOREACH(hdr, s->s_blocks[j].b_hdrs, hdr_entry) {
+				if (add_sample(
+				    (const unsigned char *)hdr->hdr_name,
+				    strlen(hdr->hdr_name)) == -1 ||
+				    add_sample(
+				    (const unsigned char *)hdr->hdr_value,
+				    strlen(hdr->hdr_value)) == -1)
+					return (-1);
+			}
+		}
+		hpack_table_free(hpack);
+	}
+
+	return (0);
+}
+
+static int
+bench_field(const struct hpack_field *hf, void *arg)
+{
+	size_t	*count = arg;
+
+	(*count)++;
+	return (0);
+}
+
+static void
+bench_decode(struct result *r, int warm, enum bench_mode mode)
+{
+	struct story			*s;
+	struct block			*b;
+	struct hpack_table		*hpack, *enc = NULL;
+	struct hpack_block		*hbk;
+	struct hpack_header		*hdr;
+	struct hpack_fieldblock		*hfb;
+	unsigned char			**wires;
+	size_t				*wirelens;
+	size_t				 i, j, p, n;
+	uint64_t			 start, a;
+
+	memset(r, 0, sizeof(*r));
+	switch (mode) {
+	case BENCH_HEADERS:
+		r->r_op = "hpack_decode_block";
+		break;
+	case BENCH_CALLBACK:
+		r->r_op = "hpack_decode_cb";
+		break;
+	case BENCH_VALIDATE:
+		r->r_op = "hpack_decode_cb_validate";
+		break;
+	case BENCH_LAZY:
+		r->r_op = "hpack_decode_fields_lazy";
+		break;
+	}
+	r->r_variant = warm ? "warm" : "cold";
+
+	for (i = 0; i < nstories; i++) {
+		s = &stories[i];
+		n = s->s_nblocks * passes;
+		if (n == 0)
+			continue;
+
+		/*
+		 * The warm variant needs the blocks of a long-lived
+		 * encoder to keep the dynamic tables in sync, the cold
+		 * variant decodes the original blocks of the story.
+		 */
+		if ((wires = calloc(n, sizeof(*wires))) == NULL ||
+		    (wirelens = calloc(n, sizeof(*wirelens))) == NULL)
+			err(1, NULL);
+		if (warm &&
+		    (enc = hpack_table_new(s->s_table_size)) == NULL)
+			err(1, NULL);
+		for (p = 0; p < passes; p++) {
+			for (j = 0; j < s->s_nblocks; j++) {
+				b = &s->s_blocks[j];
+				if (!warm) {
+					wires[p * s->s_nblocks + j] = b->b_wire;
+					wirelens[p * s->s_nblocks + j] =
+					    b->b_wirelen;
+				} else if ((wires[p * s->s_nblocks + j] =
+				    hpack_encode(b->b_hdrs,
+				    &wirelens[p * s->s_nblocks + j],
+				    enc)) == NULL)
+					errx(1, "%s: encoding failed",
+					    s->s_name);
+			}
+		}
+		if (warm)
+			hpack_table_free(enc);
+
+		hpack = NULL;
+		a = allocs;
+		start = now();
+		for (p = 0; p < passes; p++) {
+			if (!warm || p == 0) {
+				hpack_table_free(hpack);
+				if ((hpack =
+				    hpack_table_new(s->s_table_size)) == NULL ||
+				    hpack_table_setvalidate(
+				    mode == BENCH_VALIDATE, hpack) == -1)
+					err(1, NULL);
+			}
+			for (j = 0; j < s->s_nblocks; j++) {
+				r->r_bytes += wirelens[p * s->s_nblocks + j];
+				if (mode == BENCH_LAZY) {
+					/* None of the values is accessed */
+					if ((hfb = hpack_decode_fields_lazy(
+					    wires[p * s->s_nblocks + j],
+					    wirelens[p * s->s_nblocks + j],
+					    hpack)) == NULL)
+						errx(1, "%s: decoding failed",
+						    s->s_name);
+					r->r_count += hfb->hfb_nfields;
+					hpack_fieldblock_free(hfb);
+					continue;
+				}
+				if (mode == BENCH_CALLBACK ||
+				    mode == BENCH_VALIDATE) {
+					if (hpack_decode_cb(
+					    wires[p * s->s_nblocks + j],
+					    wirelens[p * s->s_nblocks + j],
+					    hpack, bench_field,
+					    &r->r_count) == -1)
+						errx(1, "%s: decoding failed",
+						    s->s_name);
+					continue;
+				}
+				if ((hbk = hpack_decode_block(
+				    wires[p * s->s_nblocks + j],
+				    wirelens[p * s->s_nblocks + j],
+				    hpack)) == NULL)
+					errx(1, "%s: decoding failed",
+					    s->s_name);
+				TAILQ_FOREACH(hdr, &hbk->hbk_headers,
+				    hdr_entry)
+					r->r_count++;
+				hpack_block_free(hbk);
+			}
+		}
+		hpack_table_free(hpack);
+		r->r_nsec += now() - start;
+		r->r_allocs += allocs - a;
+
+		if (warm)
+			for (j = 0; j < n; j++)
+				free(wires[j]);
+		free(wires);
+		free(wirelens);
+	}
+}
+
+static void
+bench_encode(struct result *r, int warm, int array)
+{
+	struct story			*s;
+	struct block			*b;
+	struct hpack_table		*hpack;
+	struct hpack_header		*hdr;
+	struct hpack_field		*fields = NULL;
+	unsigned char			*wire;
+	size_t				 i, j, p, len, n, nfields = 0;
+	uint64_t			 start, a;
+
+	memset(r, 0, sizeof(*r));
+	r->r_op = array ? "hpack_encode_fields" : "hpack_encode";
+	r->r_variant = warm ? "warm" : "cold";
+
+	/* The array is owned by the caller and reused for each block */
+	for (i = 0; array && i < nstories; i++) {
+		for (j = 0; j < stories[i].s_nblocks; j++) {
+			n = 0;
+			TAILQ_FOREACH(hdr, stories[i].s_blocks[j].b_hdrs,
+			    hdr_entry)
+				n++;
+			if (n > nfields)
+				nfields = n;
+		}
+	}
+	if (nfields > 0 &&
+	    (fields = calloc(nfields, sizeof(*fields))) == NULL)
+		err(1, NULL);
+
+	for (i = 0; i < nstories; i++) {
+		s = &stories[i];
+		hpack = NULL;
+		a = allocs;
+		start = now();
+		for (p = 0; p < passes; p++) {
+			if (!warm || p == 0) {
+				hpack_table_free(hpack);
+				if ((hpack =
+				    hpack_table_new(s->s_table_size)) == NULL)
+					err(1, NULL);
+			}
+			for (j = 0; j < s->s_nblocks; j++) {
+				b = &s->s_blocks[j];
+				if (!array)
+					wire = hpack_encode(b->b_hdrs,
+					    &len, hpack);
+				else {
+					n = 0;
+					TAILQ_FOREACH(hdr, b->b_hdrs,
+					    hdr_entry) {
+						fields[n].hpf_name =
+						    hdr->hdr_name;
+						fields[n].hpf_name_len =
+						    hdr->hdr_name_len;
+						fields[n].hpf_value =
+						    hdr->hdr_value;
+						fields[n].hpf_value_len =
+						    hdr->hdr_value_len;
+						fields[n].hpf_index =
+						    hdr->hdr_index;
+						n++;
+					}
+					wire = hpack_encode_fields(fields, n,
+					    &len, hpack);
+				}
+				if (wire == NULL)
+					errx(1, "%s: encoding failed",
+					    s->s_name);
+				free(wire);
+			}
+		}
+		hpack_table_free(hpack);
+		r->r_nsec += now() - start;
+		r->r_allocs += allocs - a;
+
+		/* Count outside of the timed loop */
+		for (j = 0; j < s->s_nblocks; j++) {
+			TAILQ_FOREACH(hdr, s->s_blocks[j].b_hdrs, hdr_entry) {
+				r->r_count += passes;
+				r->r_bytes += passes *
+				    (strlen(hdr->hdr_name) +
+				    strlen(hdr->hdr_value));
+			}
+		}
+	}
+	free(fields);
+}
+
+static void
+bench_relay(struct result *r, int lazy)
+{
+	struct story			*s;
+	struct block			*b;
+	struct hpack_table		*dec = NULL, *enc = NULL;
+	struct hpack_block		*hbk;
+	struct hpack_header		*hdr;
+	struct hpack_fieldblock		*hfb;
+	unsigned char			*wire;
+	size_t				 i, j, p, len;
+	uint64_t			 start, a;
+
+	memset(r, 0, sizeof(*r));
+	r->r_op = lazy ? "relay_fields_lazy" : "relay_headers";
+	r->r_variant = "cold";
+
+	/* Decode each block and encode it again for another connection */
+	for (i = 0; i < nstories; i++) {
+		s = &stories[i];
+		a = allocs;
+		start = now();
+		for (p = 0; p < passes; p++) {
+			if ((dec = hpack_table_new(s->s_table_size)) == NULL ||
+			    (enc = hpack_table_new(s->s_table_size)) == NULL)
+				err(1, NULL);
+			for (j = 0; j < s->s_nblocks; j++) {
+				b = &s->s_blocks[j];
+				r->r_bytes += b->b_wirelen;
+				if (lazy) {
+					if ((hfb = hpack_decode_fields_lazy(
+					    b->b_wire, b->b_wirelen,
+					    dec)) == NULL ||
+					    (wire = hpack_encode_fields(
+					    hfb->hfb_fields, hfb->hfb_nfields,
+					    &len, enc)) == NULL)
+						errx(1, "%s: relaying failed",
+						    s->s_name);
+					r->r_count += hfb->hfb_nfields;
+					hpack_fieldblock_free(hfb);
+				} else {
+					if ((hbk = hpack_decode_block(
+					    b->b_wire, b->b_wirelen,
+					    dec)) == NULL ||
+					    (wire = hpack_encode(
+					    &hbk->hbk_headers,
+					    &len, enc)) == NULL)
+						errx(1, "%s: relaying failed",
+						    s->s_name);
+					TAILQ_FOREACH(hdr, &hbk->hbk_headers,
+					    hdr_entry)
+						r->r_count++;
+					hpack_block_free(hbk);
+				}
+				free(wire);
+			}
+			hpack_table_free(dec);
+			hpack_table_free(enc);
+		}
+		r->r_nsec += now() - start;
+		r->r_allocs += allocs - a;
+	}
+}
+
+static void
+bench_huffman_decode(struct result *r)
+{
+	struct sample	*hs;
+	unsigned char	*data;
+	size_t		 i, p, len;
+	uint64_t	 start, a;
+
+	memset(r, 0, sizeof(*r));
+	r->r_op = "hpack_huffman_decode";
+	r->r_variant = "-";
+
+	a = allocs;
+	start = now();
+	for (p = 0; p < passes; p++) {
+		for (i = 0; i < nsamples; i++) {
+			hs = &samples[i];
+			if ((data = hpack_huffman_decode(hs->hs_huffman,
+			    hs->hs_huffman_len, &len)) == NULL)
+				errx(1, "huffman decoding failed");
+			free(data);
+		}
+	}
+	r->r_nsec = now() - start;
+	r->r_allocs = allocs - a;
+
+	for (i = 0; i < nsamples; i++)
+		r->r_bytes += samples[i].hs_huffman_len * passes;
+	r->r_count = nsamples * passes;
+}
+
+static void
+bench_huffman_encode(struct result *r)
+{
+	struct sample	*hs;
+	unsigned char	*data;
+	size_t		 i, p, len;
+	uint64_t	 start, a;
+
+	memset(r, 0, sizeof(*r));
+	r->r_op = "hpack_huffman_encode";
+	r->r_variant = "-";
+
+	a = allocs;
+	start = now();
+	for (p = 0; p < passes; p++) {
+		for (i = 0; i < nsamples; i++) {
+			hs = &samples[i];
+			if ((data = hpack_huffman_encode(hs->hs_data,
+			    hs->hs_len, &len)) == NULL)
+				errx(1, "huffman encoding failed");
+			free(data);
+		}
+	}
+	r->r_nsec = now() - start;
+	r->r_allocs = allocs - a;
+
+	for (i = 0; i < nsamples; i++)
+		r->r_bytes += samples[i].hs_len * passes;
+	r->r_count = nsamples * passes;
+}
+
+static void
+bench_print(struct result *r)
+{
+	double	 nsop = 0, mbs = 0, allocsop = 0;
+
+	if (r->r_count > 0) {
+		nsop = (double)r->r_nsec / r->r_count;
+		allocsop = (double)r->r_allocs / r->r_count;
+	}
+	if (r->r_nsec > 0)
+		mbs = (double)r->r_bytes * 1000 / r->r_nsec;
+
+	if (machine)
+		printf("%s\t%s\t%zu\t%zu\t%llu\t%.2f\t%.2f\t%.3f\n",
+		    r->r_op, r->r_variant, r->r_count, r->r_bytes,
+		    (unsigned long long)r->r_nsec, nsop, mbs, allocsop);
+	else
+		printf("%-24s %-5s %10zu %12zu %10.1f %10.2f %10.3f\n",
+		    r->r_op, r->r_variant, r->r_count, r->r_bytes,
+		    nsop, mbs, allocsop);
+}
+
+__dead void
+usage(void)
+{
+	extern char	*__progname;
+
+	fprintf(stderr, "usage: %s [-m] [-n passes] dir ...\n",
+	    __progname);
+	exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct result	 r;
+	const char	*errstr;
+	int		 ch;
+
+	if (hpack_init() == -1)
+		errx(1, "hpack_init");
+	if (hpack_allocator_set(&bench_allocator) == -1)
+		errx(1, "hpack_allocator_set");
+
+	while ((ch = getopt(argc, argv, "mn:")) != -1) {
+		switch (ch) {
+		case 'm':
+			machine = 1;
+			break;
+		case 'n':
+			passes = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "passes %s: %s", errstr, optarg);
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+
+	if (argc < 1)
+		usage();
+	if (load_dir(argv) == -1)
+		err(1, "failed to load the samples");
+	if (nstories == 0 && nsamples == 0)
+		errx(1, "no samples found");
+
+	/*
+	 * An op is a header for the encoder and decoder or a string
+	 * for the Huffman code, the bytes are the input of each op.
+	 */
+	if (machine)
+		printf("op\tvariant\tcount\tbytes\tnsec\t"
+		    "ns_per_op\tmb_per_s\tallocs_per_op\n");
+	else
+		printf("%-24s %-5s %10s %12s %10s %10s %10s\n",
+		    "op", "table", "count", "bytes",
+		    "ns/op", "MB/s", "allocs/op");
+
+	bench_decode(&r, 0, BENCH_HEADERS);
+	bench_print(&r);
+	bench_decode(&r, 1, BENCH_HEADERS);
+	bench_print(&r);
+	bench_decode(&r, 0, BENCH_CALLBACK);
+	bench_print(&r);
+	bench_decode(&r, 1, BENCH_CALLBACK);
+	bench_print(&r);
+	bench_decode(&r, 0, BENCH_VALIDATE);
+	bench_print(&r);
+	bench_decode(&r, 1, BENCH_VALIDATE);
+	bench_print(&r);
+	bench_decode(&r, 0, BENCH_LAZY);
+	bench_print(&r);
+	bench_decode(&r, 1, BENCH_LAZY);
+	bench_print(&r);
+	bench_encode(&r, 0, 0);
+	bench_print(&r);
+	bench_encode(&r, 1, 0);
+	bench_print(&r);
+	bench_encode(&r, 0, 1);
+	bench_print(&r);
+	bench_encode(&r, 1, 1);
+	bench_print(&r);
+	bench_relay(&r, 0);
+	bench_print(&r);
+	bench_relay(&r, 1);
+	bench_print(&r);
+	bench_huffman_decode(&r);
+	bench_print(&r);
+	bench_huffman_encode(&r);
+	bench_print(&r);
+
+	return (0);
+}
@@ -0,0 +1,305 @@
+/*	$OpenBSD$	*/
+
+/*
+ * Copyright (c) 2019 Reyk Floeter <reyk@openbsd.org>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Generate the compile-time lookup tables in hpack_tables.h from the
+ * static table and the Huffman code in hpack.h.
+ */
+
+#include <sys/types.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <err.h>
+#include <stdatomic.h>
+
+#define HPACK_INTERNAL
+#include "hpack.h"
+
+static int	 static_hash(void);
+static int	 huffman_tree(void);
+static void	 huffman_fsm(void);
+static int	 huffman_print(void);
+static void	 char_class(void);
+
+/* Internal nodes of the Huffman tree, the root is node 0 */
+static struct hpack_huffman_node	 nodes[HPACK_HUFFMAN_STATES];
+static int				 node_accept[HPACK_HUFFMAN_STATES];
+static struct hpack_huffman_state	 fsm[HPACK_HUFFMAN_STATES]
+					    [1 << HPACK_HUFFMAN_BITS];
+
+static int
+static_hash(void)
+{
+	struct hpack_static_hash	 hash[1 << HPACK_STATIC_HASH_BITS];
+	struct hpack_index		*id;
+	uint32_t			 mul, seed = 1;
+	size_t				 i, j, len;
+	unsigned int			 h;
+
+	/* The lengths in the static table are maintained by hand */
+	for (i = 0; i < HPACK_STATIC_SIZE; i++) {
+		id = &static_table[i];
+		if (id->hpi_name_len != strlen(id->hpi_name) ||
+		    id->hpi_value_len != (id->hpi_value == NULL ?
+		    0 : strlen(id->hpi_value)))
+			errx(1, "static table entry %ld: invalid length",
+			    id->hpi_id);
+	}
+
+	/*
+	 * Search a multiplier that maps the length, first and last
+	 * character of each name to a different slot.
+	 */
+	for (;;) {
+		seed = seed * 1103515245 + 12345;
+		mul = seed | 1;
+		memset(hash, 0, sizeof(hash));
+
+		for (i = 0; i < HPACK_STATIC_SIZE; i++) {
+			id = &static_table[i];
+			len = strlen(id->hpi_name);
+			h = HPACK_STATIC_HASH(mul, len,
+			    id->hpi_name[0], id->hpi_name[len - 1]);
+			if (hash[h].hsh_id != 0) {
+				/* Entries with the same name are adjacent */
+				if (strcmp(static_table[hash[h].hsh_id -
+				    1].hpi_name, id->hpi_name) != 0)
+					break;
+				hash[h].hsh_count++;
+				continue;
+			}
+			hash[h].hsh_id = id->hpi_id;
+			hash[h].hsh_count = 1;
+			hash[h].hsh_len = len;
+		}
+		if (i == HPACK_STATIC_SIZE)
+			break;
+	}
+
+	printf("/*\n * Perfect hash of the static table names "
+	    "(%zu slots).\n */\n", sizeof(hash) / sizeof(hash[0]));
+	printf("#define HPACK_STATIC_HASH_MUL\t0x%08xU\n\n", mul);
+	printf("static const struct hpack_static_hash static_hash[] = {\n");
+	for (i = 0; i < sizeof(hash) / sizeof(hash[0]); i++) {
+		if (hash[i].hsh_id == 0) {
+			printf("\t{ 0,\t0,\t0 },\n");
+			continue;
+		}
+		printf("\t{ %u,\t%u,\t%u },\t/* %s",
+		    hash[i].hsh_id, hash[i].hsh_count, hash[i].hsh_len,
+		    static_table[hash[i].hsh_id - 1].hpi_name);
+		for (j = 1; j < hash[i].hsh_count; j++)
+			printf(" (%zu)", hash[i].hsh_id + j);
+		printf(" */\n");
+	}
+	printf("};\n");
+
+	/* Entries with the same name are adjacent and share the token */
+	printf("\n/*\n * Token of the name of each static table entry.\n"
+	    " */\nstatic const unsigned char static_token[] = {\n"
+	    "\t0,\t/* unknown */\n");
+	for (i = 0, j = 0; i < HPACK_STATIC_SIZE; i++) {
+		id = &static_table[i];
+		if (i == 0 ||
+		    strcmp(static_table[i - 1].hpi_name, id->hpi_name) != 0)
+			j = i + 1;
+		printf("\t%zu,\t/* %ld %s */\n", j, id->hpi_id, id->hpi_name);
+	}
+	printf("};\n");
+
+	return (0);
+}
+
+static int
+huffman_tree(void)
+{
+	struct hpack_huffman	*hph;
+	unsigned int		 i, j, bit, count = 1, node, depth;
+	int			 ones;
+
+	memset(nodes, 0, sizeof(nodes));
+	node_accept[0] = 1;
+
+	for (i = 0; i < HPACK_HUFFMAN_SIZE; i++) {
+		hph = &huffman_table[i];
+		node = 0;
+		ones = 1;
+
+		/* Create a branch of internal nodes for each symbol */
+		for (j = hph->hph_length; j > 1; j--) {
+			bit = (hph->hph_code >> (j - 1)) & 1;
+			ones = ones && bit;
+			if (nodes[node].hpn_child[bit] == 0) {
+				if (count >= HPACK_HUFFMAN_STATES)
+					return (-1);
+
+				/*
+				 * The end of the input is only valid at
+				 * the root or on a path of up to 7 bits
+				 * that matches the most significant bits
+				 * of the EOS code (padding).
+				 */
+				depth = hph->hph_length - j + 1;
+				node_accept[count] = depth < 8 && ones;
+				nodes[node].hpn_child[bit] = count++;
+			}
+			if ((node = nodes[node].hpn_child[bit]) >=
+			    HPACK_HUFFMAN_LEAF)
+				return (-1);
+		}
+
+		/* The leaf contains the (8-bit ASCII) symbol or EOS */
+		bit = hph->hph_code & 1;
+		if (nodes[node].hpn_child[bit] != 0)
+			return (-1);
+		nodes[node].hpn_child[bit] = HPACK_HUFFMAN_LEAF + i;
+	}
+	if (count != HPACK_HUFFMAN_STATES)
+		return (-1);
+
+	return (0);
+}
+
+static void
+huffman_fsm(void)
+{
+	struct hpack_huffman_state	*hps;
+	unsigned int			 state, bits, bit, j, node, child;
+
+	memset(fsm, 0, sizeof(fsm));
+
+	for (state = 0; state < HPACK_HUFFMAN_STATES; state++) {
+		for (bits = 0; bits < (1 << HPACK_HUFFMAN_BITS); bits++) {
+			hps = &fsm[state][bits];
+			node = state;
+
+			/* Walk the tree for the input bits of this step */
+			for (j = HPACK_HUFFMAN_BITS; j > 0; j--) {
+				bit = (bits >> (j - 1)) & 1;
+				child = nodes[node].hpn_child[bit];
+				if (child < HPACK_HUFFMAN_LEAF) {
+					node = child;
+					continue;
+				}
+				if (child - HPACK_HUFFMAN_LEAF >= 256) {
+					/* EOS must not appear in the string */
+					hps->hps_flags = HPACK_HUFFMAN_F_FAIL;
+					break;
+				}
+				hps->hps_flags |= HPACK_HUFFMAN_F_SYM;
+				hps->hps_sym = child - HPACK_HUFFMAN_LEAF;
+				node = 0;
+			}
+			if (hps->hps_flags & HPACK_HUFFMAN_F_FAIL)
+				continue;
+
+			hps->hps_state = node;
+			if (node_accept[node])
+				hps->hps_flags |= HPACK_HUFFMAN_F_ACCEPT;
+		}
+	}
+}
+
+static int
+huffman_print(void)
+{
+	struct hpack_huffman_state	*hps;
+	unsigned int			 state, bits;
+
+	if (huffman_tree() == -1)
+		return (-1);
+	huffman_fsm();
+
+	printf("\n#ifndef HPACK_HUFFMAN_TREE\n");
+	printf("/*\n * Huffman decoding state machine "
+	    "(%d states, %d bits per step).\n */\n",
+	    HPACK_HUFFMAN_STATES, HPACK_HUFFMAN_BITS);
+	printf("static const struct hpack_huffman_state "
+	    "huffman_fsm[%d][%d] = {\n",
+	    HPACK_HUFFMAN_STATES, 1 << HPACK_HUFFMAN_BITS);
+	for (state = 0; state < HPACK_HUFFMAN_STATES; state++) {
+		printf("\t{ /* %u */\n", state);
+		for (bits = 0; bits < (1 << HPACK_HUFFMAN_BITS); bits++) {
+			hps = &fsm[state][bits];
+			printf("%s{ %u, %u, %u },%s",
+			    bits % 4 == 0 ? "\t\t" : " ",
+			    hps->hps_state, hps->hps_flags, hps->hps_sym,
+			    bits % 4 == 3 ? "\n" : "");
+		}
+		printf("\t},\n");
+	}
+	printf("};\n");
+
+	printf("#else\n");
+	printf("/*\n * Huffman decoding tree (%d internal nodes).\n */\n",
+	    HPACK_HUFFMAN_STATES);
+	printf("static const struct hpack_huffman_node "
+	    "huffman_tree[%d] = {\n", HPACK_HUFFMAN_STATES);
+	for (state = 0; state < HPACK_HUFFMAN_STATES; state++)
+		printf("\t{ { %u,\t%u } },\t/* %u */\n",
+		    nodes[state].hpn_child[0], nodes[state].hpn_child[1],
+		    state);
+	printf("};\n");
+	printf("#endif /* HPACK_HUFFMAN_TREE */\n");
+
+	return (0);
+}
+
+static void
+char_class(void)
+{
+	unsigned int	 c, cls;
+
+	printf("\n/*\n * Character classes of decoded names and values.\n"
+	    " */\nstatic const unsigned char char_class[256] = {\n");
+	for (c = 0; c < 256; c++) {
+		cls = 0;
+		if (c == '\0')
+			cls |= HPACK_CHAR_NUL;
+		if (c == '\0' || c == '\r' || c == '\n')
+			cls |= HPACK_CHAR_VALUE;
+		if (c <= ' ' || c >= 0x7f)
+			cls |= HPACK_CHAR_NAME;
+		if (c >= 'A' && c <= 'Z')
+			cls |= HPACK_CHAR_UPPER;
+		printf("%s0x%02x,%s", c % 8 == 0 ? "\t" : " ", cls,
+		    c % 8 == 7 ? "\n" : "");
+	}
+	printf("};\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+	printf("/*\t$OpenBSD$\t*/\n\n"
+	    "/*\n * Generated by hpackgen from hpack.h, do not edit.\n */\n\n"
+	    "#ifndef HPACK_TABLES_H\n#define HPACK_TABLES_H\n\n");
+
+	if (static_hash() == -1)
+		errx(1, "failed to generate the static table hash");
+	if (huffman_print() == -1)
+		errx(1, "failed to generate the Huffman decoding tables");
+	char_class();
+
+	printf("\n#endif /* HPACK_TABLES_H */\n");
+
+	return (0);
+}
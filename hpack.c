@@ -22,44 +22,174 @@
 #include <string.h>
 #include <stdlib.h>
 #include <limits.h>
+#include <stdint.h>
 #include <math.h>
 #include <err.h>
+#include <stdatomic.h>
+
+/*
+ * The vector kernels are compiled for their instruction set with
+ * function attributes and selected at runtime by the CPU features.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HPACK_SIMD_X86
+#include <immintrin.h>
+#endif
 
 #define HPACK_INTERNAL
 #include "hpack.h"
+#include "hpack_tables.h"
 
 static const struct hpack_index *
 		 hpack_table_getbyid(long, struct hpack_index *,
 		    struct hpack_table *);
 static const struct hpack_index *
-		 hpack_table_getbyheader(struct hpack_header *,
+		 hpack_table_getbyheader(struct hpack_field *,
 		    struct hpack_index *, struct hpack_table *);
-static int	 hpack_table_add(struct hpack_header *,
+static int	 hpack_table_add(struct hpack_field *,
 		    struct hpack_table *);
 static int	 hpack_table_evict(long, long, struct hpack_table *);
-static int	 hpack_table_setsize(long, struct hpack_table *);
+static int	 hpack_table_grow(struct hpack_table *);
+static struct hpack_entry *
+		 hpack_table_entry(long, struct hpack_table *);
+static long	 hpack_table_dynidx(long, struct hpack_table *);
+static void	 hpack_table_link(long, struct hpack_table *);
+static void	 hpack_table_unlink(long, struct hpack_table *);
+static int	 hpack_table_admit(struct hpack_field *,
+		    struct hpack_table *);
+static unsigned int
+		 hpack_sketch_add(struct hpack_sketch *, unsigned int);
+static unsigned int
+		 hpack_sketch_get(struct hpack_sketch *, unsigned int);
+
+static unsigned int
+		 hpack_hash(unsigned int, const char *, size_t);
+static const struct hpack_static_hash *
+		 hpack_static_getbyname(const char *, size_t);
+static enum hpack_token
+		 hpack_token_getbyname(const char *, size_t);
+
+static void	*hpack_malloc(const struct hpack_allocator *, size_t);
+static void	*hpack_calloc(const struct hpack_allocator *, size_t, size_t);
+static void	*hpack_reallocarray(const struct hpack_allocator *, void *,
+		    size_t, size_t);
+static void	*hpack_recallocarray(const struct hpack_allocator *, void *,
+		    size_t, size_t, size_t);
+static void	 hpack_free(const struct hpack_allocator *, void *);
+static void	 hpack_freezero(const struct hpack_allocator *, void *,
+		    size_t);
+static char	*hpack_strdup(const struct hpack_allocator *,
+		    struct hpack_arena **, const char *, size_t);
+static struct hpack_ref *
+		 hpack_ref_new(const struct hpack_allocator *, size_t);
+static void	 hpack_ref_get(struct hpack_ref *);
+static void	 hpack_ref_put(struct hpack_ref *);
+
+static int	 hpack_allocator_valid(const struct hpack_allocator *);
+
+static struct hpack_header *
+		 hpack_header_insert(struct hpack_headerblock *,
+		    const struct hpack_allocator *, struct hpack_arena **,
+		    const char *, size_t, const char *, size_t,
+		    enum hpack_header_index);
+static void	 hpack_header_release(const struct hpack_allocator *,
+		    struct hpack_header *);
 
 static long	 hpack_decode_int(struct hbuf *, unsigned char);
-static char	*hpack_decode_str(struct hbuf *, unsigned char);
-static int	 hpack_decode_buf(struct hbuf *, struct hpack_table *);
+static int	 hpack_decode_str(struct hbuf *, unsigned char,
+		    const char **, size_t *, unsigned int *, int,
+		    struct hpack_arena **, struct hpack_table *);
+static unsigned char
+		 hpack_validate(const unsigned char *, size_t, unsigned char,
+		    size_t *);
+static void	 hpack_validate_error(struct hpack_table *, unsigned char,
+		    int, size_t, const unsigned char *, size_t);
+static size_t	 hpack_validate_init(const unsigned char *, size_t,
+		    unsigned char);
+static void	 hpack_validate_setup(void);
+static size_t	 hpack_validate_scalar(const unsigned char *, size_t,
+		    unsigned char);
+#ifdef HPACK_SIMD_X86
+static size_t	 hpack_validate_sse2(const unsigned char *, size_t,
+		    unsigned char);
+static size_t	 hpack_validate_avx2(const unsigned char *, size_t,
+		    unsigned char);
+static size_t	 hpack_validate_avx512(const unsigned char *, size_t,
+		    unsigned char);
+#endif
+static int	 hpack_decode_field(struct hbuf *, struct hpack_field *,
+		    int, struct hpack_ref **, struct hpack_arena **,
+		    struct hpack_table *);
+static struct hpack_fieldblock *
+		 hpack_decode_fieldblock(unsigned char *, size_t, int,
+		    struct hpack_table *);
+static int	 hpack_decode_hdrs(unsigned char *, size_t,
+		    struct hpack_headerblock *, const struct hpack_allocator *,
+		    struct hpack_arena **, struct hpack_pseudo *,
+		    struct hpack_table *);
+static int	 hpack_decoder_field(struct hpack_decoder *, struct hbuf *,
+		    struct hpack_headerblock *);
+static int	 hpack_decode_header(struct hpack_headerblock *,
+		    const struct hpack_allocator *, struct hpack_arena **,
+		    struct hpack_field *, struct hpack_pseudo *,
+		    struct hpack_table *);
+static int	 hpack_decode_pseudo_field(const struct hpack_allocator *,
+		    struct hpack_arena **, struct hpack_field *,
+		    struct hpack_pseudo *);
+static enum hpack_method
+		 hpack_method_parse(const char *, size_t);
 static long	 hpack_decode_index(struct hbuf *, unsigned char,
-		    const struct hpack_index **, struct hpack_table *);
-static int	 hpack_decode_literal(struct hbuf *, unsigned char,
+		    struct hpack_field *, int, struct hpack_ref **,
+		    struct hpack_arena **, struct hpack_table *);
+static long	 hpack_decode_literal(struct hbuf *, unsigned char,
+		    struct hpack_field *, int, struct hpack_arena **,
+		    struct hpack_table *);
+static unsigned char
+		*hpack_encode_alloc(struct hpack_headerblock *,
+		    const struct hpack_field *, size_t, size_t *,
+		    struct hpack_table *);
+static int	 hpack_encode_data(struct hpack_headerblock *,
+		    const struct hpack_field *, size_t, unsigned char *,
+		    size_t, size_t *, struct hpack_table *);
+static int	 hpack_encode_next(struct hpack_field *,
+		    struct hpack_header **, const struct hpack_field *,
+		    size_t, size_t *);
+static int	 hpack_encode_hdrs(struct hbuf *, struct hpack_headerblock *,
+		    const struct hpack_field *, size_t, struct hpack_table *);
+static int	 hpack_encode_bound(struct hpack_headerblock *,
+		    const struct hpack_field *, size_t, size_t *,
 		    struct hpack_table *);
 static int	 hpack_encode_int(struct hbuf *, long, unsigned char,
 		    unsigned char);
-static int	 hpack_encode_str(struct hbuf *, char *);
-
-static int	 hpack_huffman_init(void);
-static struct hpack_huffman_node *
-		 hpack_huffman_new(void);
-static void	 hpack_huffman_free(struct hpack_huffman_node *);
+static size_t	 hpack_encode_intlen(long, unsigned char);
+static size_t	 hpack_encode_strlen(const char *, size_t, unsigned int);
+static int	 hpack_encode_str(struct hbuf *, const char *, size_t,
+		    unsigned int, struct hpack_table *);
+
+static ssize_t	 hpack_huffman_decode_buf(const unsigned char *, size_t,
+		    unsigned char *, unsigned char *);
+static int	 hpack_huffman_check(const unsigned char *, size_t,
+		    unsigned char *);
+static size_t	 hpack_huffman_encode_len(const unsigned char *, size_t,
+		    size_t);
+static void	 hpack_huffman_encode_buf(const unsigned char *, size_t,
+		    unsigned char *);
+
+static void	*hpack_arena_alloc(const struct hpack_allocator *,
+		    struct hpack_arena **, size_t);
+static void	 hpack_arena_trim(struct hpack_arena **, void *, size_t);
+static int	 hpack_arena_copy(const struct hpack_allocator *,
+		    struct hpack_arena **, const char **, size_t);
+static void	 hpack_arena_reset(struct hpack_arena **);
+static void	 hpack_arena_free(struct hpack_arena *);
 
 static struct hbuf *
 		 hbuf_new(unsigned char *, size_t);
+static void	 hbuf_init(struct hbuf *, unsigned char *, size_t);
 static void	 hbuf_free(struct hbuf *);
-static int	 hbuf_writechar(struct hbuf *, unsigned char);
-static int	 hbuf_writebuf(struct hbuf *, unsigned char *, size_t);
+static int	 hbuf_writebuf(struct hbuf *, const unsigned char *, size_t);
+static unsigned char *
+		 hbuf_reserve(struct hbuf *, size_t);
 static unsigned char *
 		 hbuf_release(struct hbuf *, size_t *);
 static int	 hbuf_readchar(struct hbuf *, unsigned char *);
@@ -67,37 +197,279 @@ static int	 hbuf_readbuf(struct hbuf *, unsigned char **, size_t);
 static int	 hbuf_advance(struct hbuf *, size_t);
 static size_t	 hbuf_left(struct hbuf *);
 
-static struct hpack	 hpack_global;
+static const struct hpack_allocator
+			*hpack_allocator;
+
+/* Returns the length of the valid prefix, resolved by hpack_init() */
+static size_t		(*_Atomic hpack_validate_prefix)(const unsigned char *,
+			    size_t, unsigned char) = hpack_validate_init;
 
 int
 hpack_init(void)
 {
-	/* Initialize the huffman tree */
-	if (hpack_huffman_init() == -1)
+	/* The Huffman decoding tables are generated at compile time */
+
+	/* Resolve the validation kernel before any threads use it */
+	hpack_validate_setup();
+
+	return (0);
+}
+
+static unsigned int
+hpack_hash(unsigned int hash, const char *str, size_t len)
+{
+	unsigned char	c;
+	size_t		i;
+
+	/* Case-insensitive FNV-1a hash to match strncasecmp() */
+	for (i = 0; i < len; i++) {
+		c = (unsigned char)str[i];
+		if (c >= 'A' && c <= 'Z')
+			c += 'a' - 'A';
+		hash = (hash ^ c) * 16777619;
+	}
+
+	return (hash);
+}
+
+#define HPACK_HASH_INIT		2166136261U
+#define HPACK_HASH_PAIR(_h, _v, _len)	hpack_hash((_h) ^ 0xff, (_v), (_len))
+
+static const struct hpack_static_hash *
+hpack_static_getbyname(const char *name, size_t len)
+{
+	const struct hpack_static_hash	*hsh;
+
+	if (len == 0)
+		return (NULL);
+	hsh = &static_hash[HPACK_STATIC_HASH(HPACK_STATIC_HASH_MUL,
+	    len, name[0], name[len - 1])];
+	if (hsh->hsh_len != len ||
+	    strncasecmp(static_table[hsh->hsh_id - 1].hpi_name,
+	    name, len) != 0)
+		return (NULL);
+
+	return (hsh);
+}
+
+static enum hpack_token
+hpack_token_getbyname(const char *name, size_t len)
+{
+	const struct hpack_static_hash	*hsh;
+
+	/*
+	 * The token is the index of the first entry with the name.
+	 * Unlike the lookup of the encoder, decoded names must match
+	 * the lower case names of the static table exactly.
+	 */
+	if ((hsh = hpack_static_getbyname(name, len)) == NULL ||
+	    memcmp(static_table[hsh->hsh_id - 1].hpi_name, name, len) != 0)
+		return (HPACK_TOKEN_UNKNOWN);
+	return ((enum hpack_token)hsh->hsh_id);
+}
+
+int
+hpack_allocator_set(const struct hpack_allocator *alloc)
+{
+	if (!hpack_allocator_valid(alloc))
 		return (-1);
+	hpack_allocator = alloc;
+	return (0);
+}
 
+static int
+hpack_allocator_valid(const struct hpack_allocator *alloc)
+{
+	if (alloc == NULL)
+		return (1);
+
+	/* Either all of the hooks or none of them */
+	if (alloc->hal_malloc != NULL && alloc->hal_realloc != NULL &&
+	    alloc->hal_free != NULL)
+		return (1);
+	if (alloc->hal_malloc == NULL && alloc->hal_realloc == NULL &&
+	    alloc->hal_free == NULL)
+		return (1);
+	DPRINTF("%s: incomplete allocator hooks", __func__);
 	return (0);
 }
 
+static void *
+hpack_malloc(const struct hpack_allocator *alloc, size_t size)
+{
+	if (!HPACK_ALLOC_HOOKS(alloc))
+		return (malloc(size));
+	return (alloc->hal_malloc(size, alloc->hal_arg));
+}
+
+static void *
+hpack_calloc(const struct hpack_allocator *alloc, size_t nmemb, size_t size)
+{
+	void	*ptr;
+
+	if (!HPACK_ALLOC_HOOKS(alloc))
+		return (calloc(nmemb, size));
+	if (size != 0 && nmemb > SIZE_MAX / size)
+		return (NULL);
+	if ((ptr = alloc->hal_malloc(nmemb * size, alloc->hal_arg)) != NULL)
+		memset(ptr, 0, nmemb * size);
+	return (ptr);
+}
+
+static void *
+hpack_reallocarray(const struct hpack_allocator *alloc, void *ptr,
+    size_t nmemb, size_t size)
+{
+	if (!HPACK_ALLOC_HOOKS(alloc))
+		return (reallocarray(ptr, nmemb, size));
+	if (size != 0 && nmemb > SIZE_MAX / size)
+		return (NULL);
+	return (alloc->hal_realloc(ptr, nmemb * size, alloc->hal_arg));
+}
+
+static void *
+hpack_recallocarray(const struct hpack_allocator *alloc, void *ptr,
+    size_t oldnmemb, size_t nmemb, size_t size)
+{
+	unsigned char	*data;
+
+	if (!HPACK_ALLOC_HOOKS(alloc))
+		return (recallocarray(ptr, oldnmemb, nmemb, size));
+	if ((data = hpack_reallocarray(alloc, ptr, nmemb, size)) == NULL)
+		return (NULL);
+
+	/* Clear the new memory, the hook has to clear the old memory */
+	if (nmemb > oldnmemb)
+		memset(data + oldnmemb * size, 0, (nmemb - oldnmemb) * size);
+	return (data);
+}
+
+static void
+hpack_free(const struct hpack_allocator *alloc, void *ptr)
+{
+	if (!HPACK_ALLOC_HOOKS(alloc))
+		free(ptr);
+	else if (ptr != NULL)
+		alloc->hal_free(ptr, alloc->hal_arg);
+}
+
+static void
+hpack_freezero(const struct hpack_allocator *alloc, void *ptr, size_t size)
+{
+	if (!HPACK_ALLOC_HOOKS(alloc))
+		freezero(ptr, size);
+	else if (ptr != NULL) {
+		explicit_bzero(ptr, size);
+		alloc->hal_free(ptr, alloc->hal_arg);
+	}
+}
+
+static char *
+hpack_strdup(const struct hpack_allocator *alloc, struct hpack_arena **arena,
+    const char *str, size_t len)
+{
+	char	*ptr;
+
+	if (len == SIZE_MAX)
+		return (NULL);
+
+	/* Copy the string with an extra NUL character */
+	if (arena != NULL)
+		ptr = hpack_arena_alloc(alloc, arena, len + 1);
+	else
+		ptr = hpack_malloc(alloc, len + 1);
+	if (ptr == NULL)
+		return (NULL);
+	memcpy(ptr, str, len);
+	ptr[len] = '\0';
+
+	return (ptr);
+}
+
+static struct hpack_ref *
+hpack_ref_new(const struct hpack_allocator *alloc, size_t len)
+{
+	struct hpack_ref	*hr;
+
+	if (len > SIZE_MAX - sizeof(*hr))
+		return (NULL);
+	if ((hr = hpack_malloc(alloc, sizeof(*hr) + len)) == NULL)
+		return (NULL);
+	hr->hr_alloc = alloc;
+	atomic_init(&hr->hr_refs, 1);
+
+	return (hr);
+}
+
+static void
+hpack_ref_get(struct hpack_ref *hr)
+{
+	atomic_fetch_add_explicit(&hr->hr_refs, 1, memory_order_relaxed);
+}
+
+static void
+hpack_ref_put(struct hpack_ref *hr)
+{
+	if (hr == NULL)
+		return;
+	/* Field blocks might be freed by another thread than the table */
+	if (atomic_fetch_sub_explicit(&hr->hr_refs, 1,
+	    memory_order_acq_rel) == 1)
+		hpack_free(hr->hr_alloc, hr);
+}
+
 struct hpack_header *
 hpack_header_new(void)
 {
+	/* The caller sets the strings that are freed with free(3) */
 	return (calloc(1, sizeof(struct hpack_header)));
 }
 
 struct hpack_header *
 hpack_header_add(struct hpack_headerblock *hdrs, const char *name,
     const char *value, enum hpack_header_index index)
+{
+	return (hpack_header_insert(hdrs, NULL, NULL,
+	    name, strlen(name), value, strlen(value), index));
+}
+
+struct hpack_header *
+hpack_header_add_len(struct hpack_headerblock *hdrs, const char *name,
+    size_t namelen, const char *value, size_t valuelen,
+    enum hpack_header_index index)
+{
+	return (hpack_header_insert(hdrs, NULL, NULL,
+	    name, namelen, value, valuelen, index));
+}
+
+static struct hpack_header *
+hpack_header_insert(struct hpack_headerblock *hdrs,
+    const struct hpack_allocator *alloc, struct hpack_arena **arena,
+    const char *name, size_t namelen, const char *value, size_t valuelen,
+    enum hpack_header_index index)
 {
 	struct hpack_header	*hdr;
 
-	if ((hdr = hpack_header_new()) == NULL)
+	/* Only the headers of a block with an arena allocator use it */
+	if (alloc == NULL || (alloc->hal_flags & HPACK_ALLOC_ARENA) == 0)
+		arena = NULL;
+	if (arena != NULL)
+		hdr = hpack_arena_alloc(alloc, arena, sizeof(*hdr));
+	else
+		hdr = hpack_malloc(alloc, sizeof(*hdr));
+	if (hdr == NULL)
 		return (NULL);
-	hdr->hdr_name = strdup(name);
-	hdr->hdr_value = strdup(value);
+	memset(hdr, 0, sizeof(*hdr));
+
+	hdr->hdr_name = hpack_strdup(alloc, arena, name, namelen);
+	hdr->hdr_value = hpack_strdup(alloc, arena, value, valuelen);
+	hdr->hdr_name_len = namelen;
+	hdr->hdr_value_len = valuelen;
 	hdr->hdr_index = index;
 	if (hdr->hdr_name == NULL || hdr->hdr_value == NULL) {
-		hpack_header_free(hdr);
+		/* The arena is released with the block */
+		if (arena == NULL)
+			hpack_header_release(alloc, hdr);
 		return (NULL);
 	}
 	TAILQ_INSERT_TAIL(hdrs, hdr, hdr_entry);
@@ -107,18 +479,26 @@ hpack_header_add(struct hpack_headerblock *hdrs, const char *name,
 
 void
 hpack_header_free(struct hpack_header *hdr)
+{
+	hpack_header_release(NULL, hdr);
+}
+
+static void
+hpack_header_release(const struct hpack_allocator *alloc,
+    struct hpack_header *hdr)
 {
 	if (hdr == NULL)
 		return;
-	free(hdr->hdr_name);
-	free(hdr->hdr_value);
-	free(hdr);
+	hpack_free(alloc, hdr->hdr_name);
+	hpack_free(alloc, hdr->hdr_value);
+	hpack_free(alloc, hdr);
 }
 
 struct hpack_headerblock *
 hpack_headerblock_new(void)
 {
 	struct hpack_headerblock	*hdrs;
+
 	if ((hdrs = calloc(1, sizeof(*hdrs))) == NULL)
 		return (NULL);
 	TAILQ_INIT(hdrs);
@@ -138,17 +518,42 @@ hpack_headerblock_free(struct hpack_headerblock *hdrs)
 	}
 }
 
+void
+hpack_block_free(struct hpack_block *hbk)
+{
+	struct hpack_header	*hdr;
+
+	if (hbk == NULL)
+		return;
+	while ((hdr = TAILQ_FIRST(&hbk->hbk_headers)) != NULL) {
+		TAILQ_REMOVE(&hbk->hbk_headers, hdr, hdr_entry);
+		if (hbk->hbk_alloc == NULL ||
+		    (hbk->hbk_alloc->hal_flags & HPACK_ALLOC_ARENA) == 0)
+			hpack_header_release(hbk->hbk_alloc, hdr);
+	}
+
+	/* Release the arena with all of its strings in one shot */
+	hpack_arena_free(hbk->hbk_arena);
+	hpack_free(hbk->hbk_alloc, hbk);
+}
+
 struct hpack_table *
 hpack_table_new(size_t max_table_size)
+{
+	return (hpack_table_new_allocator(max_table_size, hpack_allocator));
+}
+
+struct hpack_table *
+hpack_table_new_allocator(size_t max_table_size,
+    const struct hpack_allocator *alloc)
 {
 	struct hpack_table	*hpack;
 
-	if ((hpack = calloc(1, sizeof(*hpack))) == NULL)
+	if (!hpack_allocator_valid(alloc))
 		return (NULL);
-	if ((hpack->htb_dynamic = hpack_headerblock_new()) == NULL) {
-		free(hpack);
+	if ((hpack = hpack_calloc(alloc, 1, sizeof(*hpack))) == NULL)
 		return (NULL);
-	}
+	hpack->htb_alloc = alloc;
 	hpack->htb_max_table_size = hpack->htb_table_size =
 	    max_table_size == 0 ? HPACK_MAX_TABLE_SIZE : max_table_size;
 
@@ -160,8 +565,29 @@ hpack_table_free(struct hpack_table *hpack)
 {
 	if (hpack == NULL)
 		return;
-	hpack_headerblock_free(hpack->htb_dynamic);
-	free(hpack);
+	hpack_table_evict(0, 0, hpack);
+	hpack_free(hpack->htb_alloc, hpack->htb_dynamic);
+	hpack_free(hpack->htb_alloc, hpack->htb_namebuckets);
+	hpack_free(hpack->htb_alloc, hpack->htb_sketch);
+	hpack_free(hpack->htb_alloc, hpack);
+}
+
+static struct hpack_entry *
+hpack_table_entry(long dynidx, struct hpack_table *hpack)
+{
+	/* The dynamic index 1 is the newest entry before the head */
+	if (dynidx < 1 || dynidx > hpack->htb_dynamic_entries)
+		return (NULL);
+	return (&hpack->htb_dynamic[(hpack->htb_dynamic_head - dynidx) &
+	    (hpack->htb_dynamic_slots - 1)]);
+}
+
+static long
+hpack_table_dynidx(long slot, struct hpack_table *hpack)
+{
+	/* The slot before the head is the newest entry with index 1 */
+	return (((hpack->htb_dynamic_head - slot - 1) &
+	    (hpack->htb_dynamic_slots - 1)) + 1);
 }
 
 static const struct hpack_index *
@@ -169,10 +595,10 @@ hpack_table_getbyid(long index, struct hpack_index *idbuf,
     struct hpack_table *hpack)
 {
 	struct hpack_index		*id = NULL;
-	struct hpack_header		*hdr;
+	struct hpack_entry		*hte;
 	long				 dynidx = HPACK_STATIC_SIZE;
 
-	if (index < 1 || index > dynidx + (long)hpack->htb_dynamic_size)
+	if (index < 1 || index > dynidx + hpack->htb_dynamic_entries)
 		return (NULL);
 
 	if (index <= dynidx) {
@@ -183,92 +609,130 @@ hpack_table_getbyid(long index, struct hpack_index *idbuf,
 			    id->hpi_id, index);
 	} else {
 		/* Dynamic table */
-		TAILQ_FOREACH_REVERSE(hdr, hpack->htb_dynamic,
-		    hpack_headerblock, hdr_entry) {
-			dynidx++;
-			if (dynidx == index) {
-				idbuf->hpi_id = index;
-				idbuf->hpi_name = hdr->hdr_name;
-				idbuf->hpi_value = hdr->hdr_value;
-				id = idbuf;
-				break;
-			}
-		}
+		if ((hte = hpack_table_entry(index - dynidx, hpack)) == NULL)
+			return (NULL);
+		idbuf->hpi_id = index;
+		idbuf->hpi_name = hte->hte_name;
+		idbuf->hpi_value = hte->hte_value;
+		idbuf->hpi_name_len = hte->hte_name_len;
+		idbuf->hpi_value_len = hte->hte_value_len;
+		idbuf->hpi_ref = hte->hte_ref;
+		idbuf->hpi_token = hte->hte_token;
+		id = idbuf;
 	}
 
 	return (id);
 }
 
 static const struct hpack_index *
-hpack_table_getbyheader(struct hpack_header *key, struct hpack_index *idbuf,
+hpack_table_getbyheader(struct hpack_field *key, struct hpack_index *idbuf,
     struct hpack_table *hpack)
 {
-	struct hpack_index		*id = NULL, *firstid = NULL;
-	struct hpack_header		*hdr;
-	size_t				 i, dynidx = HPACK_STATIC_SIZE;
-
-	if (key->hdr_name == NULL)
+	const struct hpack_static_hash	*hsh;
+	struct hpack_index		*id;
+	struct hpack_entry		*hte;
+	unsigned int			 namehash, pairhash, i;
+	long				 slot, dynidx = 0;
+	long				 mask = hpack->htb_dynamic_slots - 1;
+
+	if (key->hpf_name == NULL)
 		return (NULL);
 
 	/*
 	 * Search the static and dynamic tables for a perfect match
-	 * or the first match that only matches the name.
+	 * or the first match that only matches the name.  The hash
+	 * chains of the dynamic table start with the newest entry,
+	 * which has the lowest index.
 	 */
+	hsh = hpack_static_getbyname(key->hpf_name, key->hpf_name_len);
+	namehash = hpack_hash(HPACK_HASH_INIT,
+	    key->hpf_name, key->hpf_name_len);
+	if (key->hpf_value != NULL &&
+	    (key->hpf_flags & HPACK_FIELD_HUFFMAN) == 0) {
+		/* Static table, the entries with the name are adjacent */
+		for (i = 0; hsh != NULL && i < hsh->hsh_count; i++) {
+			id = &static_table[hsh->hsh_id - 1 + i];
+			if (id->hpi_value != NULL &&
+			    HPACK_STREQ(id->hpi_value, id->hpi_value_len,
+			    key->hpf_value, key->hpf_value_len))
+				return (id);
+		}
 
-	/* Static table */
-	for (i = 0; i < dynidx; i++) {
-		id = &static_table[i];
-		if (strcasecmp(id->hpi_name, key->hdr_name) != 0)
-			continue;
-		if (firstid == NULL) {
-			memcpy(idbuf, id, sizeof(*id));
-			idbuf->hpi_value = NULL;
-			firstid = idbuf;
+		/* Dynamic table */
+		pairhash = HPACK_HASH_PAIR(namehash,
+		    key->hpf_value, key->hpf_value_len);
+		for (slot = hpack->htb_dynamic_entries == 0 ? -1 :
+		    hpack->htb_pairbuckets[pairhash & mask];
+		    slot != -1; slot = hte->hte_pairnext) {
+			hte = &hpack->htb_dynamic[slot];
+			if (hte->hte_pairhash != pairhash ||
+			    !HPACK_STREQ(hte->hte_name, hte->hte_name_len,
+			    key->hpf_name, key->hpf_name_len) ||
+			    !HPACK_STREQ(hte->hte_value, hte->hte_value_len,
+			    key->hpf_value, key->hpf_value_len))
+				continue;
+			idbuf->hpi_id = HPACK_STATIC_SIZE +
+			    hpack_table_dynidx(slot, hpack);
+			idbuf->hpi_name = hte->hte_name;
+			idbuf->hpi_value = hte->hte_value;
+			idbuf->hpi_name_len = hte->hte_name_len;
+			idbuf->hpi_value_len = hte->hte_value_len;
+			idbuf->hpi_ref = hte->hte_ref;
+			return (idbuf);
 		}
-		if ((id->hpi_value != NULL && key->hdr_value != NULL) &&
-		    strcasecmp(id->hpi_value, key->hdr_value) == 0)
-			return (id);
+	}
+
+	/* Static table */
+	if (hsh != NULL) {
+		memcpy(idbuf, &static_table[hsh->hsh_id - 1], sizeof(*idbuf));
+		idbuf->hpi_value = NULL;
+		idbuf->hpi_value_len = 0;
+		return (idbuf);
 	}
 
 	/* Dynamic table */
-	TAILQ_FOREACH_REVERSE(hdr, hpack->htb_dynamic,
-	    hpack_headerblock, hdr_entry) {
-		dynidx++;
-		if (strcasecmp(hdr->hdr_name, key->hdr_name) != 0)
+	for (slot = hpack->htb_dynamic_entries == 0 ? -1 :
+	    hpack->htb_namebuckets[namehash & mask];
+	    slot != -1; slot = hte->hte_namenext) {
+		hte = &hpack->htb_dynamic[slot];
+		if (hte->hte_namehash != namehash ||
+		    !HPACK_STREQ(hte->hte_name, hte->hte_name_len,
+		    key->hpf_name, key->hpf_name_len))
 			continue;
-		if (firstid == NULL) {
-			idbuf->hpi_id = dynidx;
-			idbuf->hpi_name = hdr->hdr_name;
-			idbuf->hpi_value = NULL;
-			firstid = idbuf;
-		}
-		if ((hdr->hdr_value != NULL && key->hdr_value != NULL) &&
-		    strcasecmp(hdr->hdr_value, key->hdr_value) == 0) {
-			idbuf->hpi_id = dynidx;
-			idbuf->hpi_name = hdr->hdr_name;
-			idbuf->hpi_value = hdr->hdr_value;
-			id = idbuf;
-			return (id);
-		}
+		dynidx = hpack_table_dynidx(slot, hpack);
+		break;
 	}
+	if (dynidx == 0)
+		return (NULL);
+
+	idbuf->hpi_id = HPACK_STATIC_SIZE + dynidx;
+	idbuf->hpi_name = hte->hte_name;
+	idbuf->hpi_value = NULL;
+	idbuf->hpi_name_len = hte->hte_name_len;
+	idbuf->hpi_value_len = 0;
+	idbuf->hpi_ref = hte->hte_ref;
 
-	return (firstid);
+	return (idbuf);
 }
 
 static int
-hpack_table_add(struct hpack_header *hdr, struct hpack_table *hpack)
+hpack_table_add(struct hpack_field *hf, struct hpack_table *hpack)
 {
-	long		 newsize;
+	struct hpack_entry	*hte;
+	struct hpack_ref	*ref;
+	long			 newsize;
+	char			*name, *value;
 
-	if (hdr->hdr_index != HPACK_INDEX)
-		return (0);
+	if (hf->hpf_name_len > LONG_MAX / 2 ||
+	    hf->hpf_value_len > LONG_MAX / 2)
+		return (-1);
 
 	/*
 	 * Following RFC 7451 section 4.1,
 	 * the additional 32 octets account for an estimated overhead
 	 * associated with an entry.
 	 */
-	newsize = strlen(hdr->hdr_name) + strlen(hdr->hdr_value) + 32;
+	newsize = (long)(hf->hpf_name_len + hf->hpf_value_len) + 32;
 
 	if (newsize > hpack->htb_table_size) {
 		/*
@@ -277,44 +741,156 @@ hpack_table_add(struct hpack_header *hdr, struct hpack_table *hpack)
 		 */
 		hpack_table_evict(0, newsize, hpack);
 		return (0);
-	} else
-		hpack_table_evict(hpack->htb_table_size,
-		    newsize, hpack);
+	}
 
-	if (hpack_header_add(hpack->htb_dynamic,
-	    hdr->hdr_name, hdr->hdr_value, hdr->hdr_index) == NULL)
+	/*
+	 * Copy both strings into one shared buffer before evicting
+	 * entries, the field might reference the name of an entry in
+	 * the dynamic table.
+	 */
+	if ((ref = hpack_ref_new(hpack->htb_alloc,
+	    hf->hpf_name_len + hf->hpf_value_len + 2)) == NULL)
 		return (-1);
+	name = ref->hr_data;
+	memcpy(name, hf->hpf_name, hf->hpf_name_len);
+	name[hf->hpf_name_len] = '\0';
+	value = name + hf->hpf_name_len + 1;
+	memcpy(value, hf->hpf_value, hf->hpf_value_len);
+	value[hf->hpf_value_len] = '\0';
+
+	hpack_table_evict(hpack->htb_table_size, newsize, hpack);
+	if (hpack->htb_dynamic_entries == hpack->htb_dynamic_slots &&
+	    hpack_table_grow(hpack) == -1) {
+		hpack_ref_put(ref);
+		return (-1);
+	}
+
+	hte = &hpack->htb_dynamic[hpack->htb_dynamic_head];
+	hte->hte_name = name;
+	hte->hte_value = value;
+	hte->hte_name_len = hf->hpf_name_len;
+	hte->hte_value_len = hf->hpf_value_len;
+	hte->hte_ref = ref;
+	hte->hte_token = hf->hpf_token;
+	hte->hte_size = newsize;
+	hte->hte_namehash = hpack_hash(HPACK_HASH_INIT,
+	    name, hte->hte_name_len);
+	hte->hte_pairhash = HPACK_HASH_PAIR(hte->hte_namehash,
+	    value, hte->hte_value_len);
+	hpack_table_link(hpack->htb_dynamic_head, hpack);
+
+	hpack->htb_dynamic_head =
+	    (hpack->htb_dynamic_head + 1) & (hpack->htb_dynamic_slots - 1);
 	hpack->htb_dynamic_entries++;
 	hpack->htb_dynamic_size += newsize;
 
+	hpack->htb_stats.hst_inserts++;
+	if ((size_t)hpack->htb_dynamic_size > hpack->htb_stats.hst_peak_size)
+		hpack->htb_stats.hst_peak_size =
+		    (size_t)hpack->htb_dynamic_size;
+
+	return (0);
+}
+
+static void
+hpack_table_link(long slot, struct hpack_table *hpack)
+{
+	struct hpack_entry	*hte = &hpack->htb_dynamic[slot];
+	long			 mask = hpack->htb_dynamic_slots - 1;
+
+	/* Insert the newest entry at the start of its hash chains */
+	hte->hte_namenext = hpack->htb_namebuckets[hte->hte_namehash & mask];
+	hpack->htb_namebuckets[hte->hte_namehash & mask] = slot;
+	hte->hte_pairnext = hpack->htb_pairbuckets[hte->hte_pairhash & mask];
+	hpack->htb_pairbuckets[hte->hte_pairhash & mask] = slot;
+}
+
+static void
+hpack_table_unlink(long slot, struct hpack_table *hpack)
+{
+	struct hpack_entry	*hte = &hpack->htb_dynamic[slot];
+	long			 mask = hpack->htb_dynamic_slots - 1;
+	long			*next;
+
+	/* The oldest entry is always at the end of its hash chains */
+	for (next = &hpack->htb_namebuckets[hte->hte_namehash & mask];
+	    *next != slot; next = &hpack->htb_dynamic[*next].hte_namenext)
+		;
+	*next = -1;
+	for (next = &hpack->htb_pairbuckets[hte->hte_pairhash & mask];
+	    *next != slot; next = &hpack->htb_dynamic[*next].hte_pairnext)
+		;
+	*next = -1;
+}
+
+static int
+hpack_table_grow(struct hpack_table *hpack)
+{
+	struct hpack_entry	*ring;
+	long			*buckets;
+	long			 slots, i;
+
+	/*
+	 * Double the number of slots and unroll the ring into the new
+	 * buffer, starting with the oldest entry in the first slot.
+	 */
+	slots = hpack->htb_dynamic_slots == 0 ?
+	    HPACK_DYNAMIC_SLOTS : hpack->htb_dynamic_slots * 2;
+	if ((ring = hpack_reallocarray(hpack->htb_alloc,
+	    NULL, slots, sizeof(*ring))) == NULL)
+		return (-1);
+	if ((buckets = hpack_reallocarray(hpack->htb_alloc,
+	    NULL, slots * 2, sizeof(*buckets))) == NULL) {
+		hpack_free(hpack->htb_alloc, ring);
+		return (-1);
+	}
+	for (i = 0; i < hpack->htb_dynamic_entries; i++)
+		memcpy(&ring[i], hpack_table_entry(
+		    hpack->htb_dynamic_entries - i, hpack), sizeof(*ring));
+
+	hpack_free(hpack->htb_alloc, hpack->htb_dynamic);
+	hpack_free(hpack->htb_alloc, hpack->htb_namebuckets);
+	hpack->htb_dynamic = ring;
+	hpack->htb_dynamic_slots = slots;
+	hpack->htb_dynamic_head = hpack->htb_dynamic_entries & (slots - 1);
+
+	/* Rehash all entries from the oldest to the newest */
+	hpack->htb_namebuckets = buckets;
+	hpack->htb_pairbuckets = buckets + slots;
+	for (i = 0; i < slots * 2; i++)
+		buckets[i] = -1;
+	for (i = 0; i < hpack->htb_dynamic_entries; i++)
+		hpack_table_link(i, hpack);
+
 	return (0);
 }
 
 static int
 hpack_table_evict(long size, long newsize, struct hpack_table *hpack)
 {
-	struct hpack_header	*hdr;
+	struct hpack_entry	*hte;
 
+	/* Advance the tail by evicting the oldest entries */
 	while (size < (hpack->htb_dynamic_size + newsize) &&
-	    (hdr = TAILQ_FIRST(hpack->htb_dynamic)) != NULL) {
-		TAILQ_REMOVE(hpack->htb_dynamic, hdr, hdr_entry);
+	    (hte = hpack_table_entry(hpack->htb_dynamic_entries,
+	    hpack)) != NULL) {
+		hpack_table_unlink(hte - hpack->htb_dynamic, hpack);
 		hpack->htb_dynamic_entries--;
-		hpack->htb_dynamic_size -=
-		    strlen(hdr->hdr_name) +
-		    strlen(hdr->hdr_value) +
-		    32;
-		hpack_header_free(hdr);
+		hpack->htb_dynamic_size -= hte->hte_size;
+		hpack_ref_put(hte->hte_ref);
+		hte->hte_ref = NULL;
+		hte->hte_name = hte->hte_value = NULL;
+		hpack->htb_stats.hst_evictions++;
 	}
 
-	if (TAILQ_EMPTY(hpack->htb_dynamic) &&
-	    hpack->htb_dynamic_entries != 0 &&
+	if (hpack->htb_dynamic_entries == 0 &&
 	    hpack->htb_dynamic_size != 0)
 		errx(1, "corrupted HPACK dynamic table");
 
 	return (0);
 }
 
-static int
+int
 hpack_table_setsize(long size, struct hpack_table *hpack)
 {
 	if (size > hpack->htb_max_table_size)
@@ -323,6 +899,7 @@ hpack_table_setsize(long size, struct hpack_table *hpack)
 	if (hpack_table_evict(size, 0, hpack) == -1)
 		return (-1);
 	hpack->htb_table_size = size;
+	hpack->htb_stats.hst_size_updates++;
 
 	return (0);
 }
@@ -333,97 +910,759 @@ hpack_table_size(struct hpack_table *hpack)
 	return ((size_t)hpack->htb_dynamic_size);
 }
 
-struct hpack_headerblock *
-hpack_decode(unsigned char *data, size_t len, struct hpack_table *hpack)
+int
+hpack_table_setpolicy(enum hpack_policy policy, struct hpack_table *hpack)
 {
-	struct hpack_headerblock	*hdrs = NULL;
-	struct hbuf			*hbuf = NULL;
-	struct hpack_table		*ctx = NULL;
-	int				 ret = -1;
+	switch (policy) {
+	case HPACK_POLICY_INDEX:
+		hpack_free(hpack->htb_alloc, hpack->htb_sketch);
+		hpack->htb_sketch = NULL;
+		break;
+	case HPACK_POLICY_FREQUENCY:
+		if (hpack->htb_sketch == NULL &&
+		    (hpack->htb_sketch = hpack_calloc(hpack->htb_alloc,
+		    1, sizeof(*hpack->htb_sketch))) == NULL)
+			return (-1);
+		break;
+	default:
+		return (-1);
+	}
 
-	if (len == 0 || len > LONG_MAX)
-		goto fail;
+	return (0);
+}
 
-	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
-		goto fail;
-	if ((hdrs = hpack_headerblock_new()) == NULL)
-		goto fail;
+int
+hpack_table_setvalidate(int validate, struct hpack_table *hpack)
+{
+	hpack->htb_validate = validate ? 1 : 0;
+	return (0);
+}
 
-	hpack->htb_headers = hdrs;
-	hpack->htb_next = NULL;
+void
+hpack_table_error(struct hpack_table *hpack, struct hpack_error *hpe)
+{
+	memcpy(hpe, &hpack->htb_error, sizeof(*hpe));
+}
 
-	if ((hbuf = hbuf_new(data, len)) == NULL)
-		goto fail;
+void
+hpack_table_stats(struct hpack_table *hpack, struct hpack_stats *hst)
+{
+	memcpy(hst, &hpack->htb_stats, sizeof(*hst));
+}
 
-	do {
-		if (hpack_decode_buf(hbuf, hpack) == -1)
-			goto fail;
-	} while (hbuf_left(hbuf) > 0);
+void
+hpack_stats_add(struct hpack_stats *sum, const struct hpack_stats *hst)
+{
+	sum->hst_static_hits += hst->hst_static_hits;
+	sum->hst_dynamic_hits += hst->hst_dynamic_hits;
+	sum->hst_name_hits += hst->hst_name_hits;
+	sum->hst_literals += hst->hst_literals;
+	sum->hst_huffman += hst->hst_huffman;
+	sum->hst_raw += hst->hst_raw;
+	sum->hst_huffman_saved += hst->hst_huffman_saved;
+	sum->hst_inserts += hst->hst_inserts;
+	sum->hst_evictions += hst->hst_evictions;
+	sum->hst_size_updates += hst->hst_size_updates;
+	sum->hst_bytes_in += hst->hst_bytes_in;
+	sum->hst_bytes_out += hst->hst_bytes_out;
+	sum->hst_peak_size = MAX(sum->hst_peak_size, hst->hst_peak_size);
+}
 
-	ret = 0;
- fail:
-	hbuf_free(hbuf);
-	if (ret != 0) {
-		hpack_headerblock_free(hdrs);
-		hdrs = NULL;
-	} else
-		hdrs = hpack->htb_headers;
-	hpack->htb_headers = NULL;
-	hpack->htb_next = NULL;
+static int
+hpack_table_admit(struct hpack_field *hf, struct hpack_table *hpack)
+{
+	struct hpack_sketch	*hsk = hpack->htb_sketch;
+	struct hpack_entry	*hte;
+	unsigned int		 pairhash, freq;
+	long			 newsize, size, dynidx;
+
+	/* Count every occurrence, including the ones that are indexed */
+	pairhash = HPACK_HASH_PAIR(hpack_hash(HPACK_HASH_INIT,
+	    hf->hpf_name, hf->hpf_name_len),
+	    hf->hpf_value, hf->hpf_value_len);
+	freq = hpack_sketch_add(hsk, pairhash);
+
+	/* Refuse entries that would evict more than half of the table */
+	if (hf->hpf_name_len > LONG_MAX / 2 ||
+	    hf->hpf_value_len > LONG_MAX / 2)
+		return (0);
+	newsize = (long)(hf->hpf_name_len + hf->hpf_value_len) + 32;
+	if (newsize > hpack->htb_table_size / 2)
+		return (0);
 
-	/* Free the local table (for single invocations) */
-	hpack_table_free(ctx);
+	/*
+	 * Only admit the new entry if it has been seen more often than
+	 * each of the oldest entries that it would evict.
+	 */
+	size = hpack->htb_dynamic_size;
+	for (dynidx = hpack->htb_dynamic_entries;
+	    hpack->htb_table_size < size + newsize &&
+	    (hte = hpack_table_entry(dynidx, hpack)) != NULL; dynidx--) {
+		if (hpack_sketch_get(hsk, hte->hte_pairhash) >= freq)
+			return (0);
+		size -= hte->hte_size;
+	}
 
-	return (hdrs);
+	return (1);
 }
 
-static long
-hpack_decode_int(struct hbuf *buf, unsigned char prefix)
+static unsigned int
+hpack_sketch_add(struct hpack_sketch *hsk, unsigned int hash)
 {
-	unsigned long	 i = 0;
-	unsigned char	 b = 0, m;
+	unsigned int	 i, j, freq = HPACK_SKETCH_MAX;
+	unsigned char	*cnt;
+
+	/* Age the counters by halving them after a number of samples */
+	if (++hsk->hsk_samples >= HPACK_SKETCH_SAMPLES) {
+		for (i = 0; i < HPACK_SKETCH_DEPTH; i++)
+			for (j = 0; j < HPACK_SKETCH_WIDTH; j++)
+				hsk->hsk_count[i][j] >>= 1;
+		hsk->hsk_samples = 0;
+	}
 
-	if (hbuf_left(buf) == 0)
-		return (-1);
+	for (i = 0; i < HPACK_SKETCH_DEPTH; i++) {
+		cnt = &hsk->hsk_count[i][(hash >> (i * 8)) &
+		    (HPACK_SKETCH_WIDTH - 1)];
+		if (*cnt < HPACK_SKETCH_MAX)
+			(*cnt)++;
+		if (*cnt < freq)
+			freq = *cnt;
+	}
 
-	if (hbuf_readchar(buf, &b) == -1 ||
-	    hbuf_advance(buf, 1) == -1)
-		return (-1);
+	return (freq);
+}
 
-	/* Mask and remainder after the prefix of the first octet */
-	m = ~prefix;
-	i = b & m;
+static unsigned int
+hpack_sketch_get(struct hpack_sketch *hsk, unsigned int hash)
+{
+	unsigned int	 i, cnt, freq = HPACK_SKETCH_MAX;
+
+	/* The estimate is the minimum of the counters */
+	for (i = 0; i < HPACK_SKETCH_DEPTH; i++) {
+		cnt = hsk->hsk_count[i][(hash >> (i * 8)) &
+		    (HPACK_SKETCH_WIDTH - 1)];
+		if (cnt < freq)
+			freq = cnt;
+	}
 
-	if (i >= m) {
-		m = 0;
+	return (freq);
+}
 
-		/* Read varint bits while the 0x80 bit is set */
-		do {
-			if (i > LONG_MAX)
+struct hpack_headerblock *
+hpack_decode(unsigned char *data, size_t len, struct hpack_table *hpack)
+{
+	struct hpack_headerblock	*hdrs;
+
+	if ((hdrs = hpack_headerblock_new()) == NULL)
+		return (NULL);
+	if (hpack_decode_hdrs(data, len, hdrs, NULL, NULL,
+	    NULL, hpack) == -1) {
+		hpack_headerblock_free(hdrs);
+		free(hdrs);
+		return (NULL);
+	}
+
+	return (hdrs);
+}
+
+struct hpack_block *
+hpack_decode_block(unsigned char *data, size_t len, struct hpack_table *hpack)
+{
+	return (hpack_decode_pseudo(data, len, NULL, hpack));
+}
+
+struct hpack_block *
+hpack_decode_pseudo(unsigned char *data, size_t len,
+    struct hpack_pseudo *pseudo, struct hpack_table *hpack)
+{
+	const struct hpack_allocator	*alloc;
+	struct hpack_block		*hbk;
+
+	/* The block and its headers use the allocator of the table */
+	alloc = hpack == NULL ? hpack_allocator : hpack->htb_alloc;
+	if ((hbk = hpack_calloc(alloc, 1, sizeof(*hbk))) == NULL)
+		return (NULL);
+	hbk->hbk_alloc = alloc;
+	TAILQ_INIT(&hbk->hbk_headers);
+	if (pseudo != NULL)
+		memset(pseudo, 0, sizeof(*pseudo));
+
+	if (hpack_decode_hdrs(data, len, &hbk->hbk_headers, alloc,
+	    &hbk->hbk_arena, pseudo, hpack) == -1) {
+		hpack_block_free(hbk);
+		return (NULL);
+	}
+
+	return (hbk);
+}
+
+static int
+hpack_decode_hdrs(unsigned char *data, size_t len,
+    struct hpack_headerblock *hdrs, const struct hpack_allocator *alloc,
+    struct hpack_arena **harena, struct hpack_pseudo *pseudo,
+    struct hpack_table *hpack)
+{
+	struct hpack_field		 hf;
+	struct hpack_ref		*ref;
+	struct hpack_arena		*arena = NULL;
+	struct hpack_table		*ctx = NULL;
+	struct hbuf			 hbuf;
+	int				 ret = -1, n;
+
+	if (len == 0 || len > LONG_MAX)
+		goto fail;
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		goto fail;
+	hpack->htb_stats.hst_bytes_in += len;
+
+	hbuf_init(&hbuf, data, len);
+
+	do {
+		if ((n = hpack_decode_field(&hbuf, &hf, 0,
+		    &ref, &arena, hpack)) == -1)
+			goto fail;
+		if (n == 0)
+			continue;
+		if (hpack_decode_header(hdrs, alloc, harena,
+		    &hf, pseudo, hpack) == -1)
+			goto fail;
+
+		/* The strings have been copied, reuse the scratch memory */
+		hpack_arena_reset(&arena);
+	} while (hbuf_left(&hbuf) > 0);
+
+	ret = 0;
+ fail:
+	hpack_arena_free(arena);
+
+	/* Free the local table (for single invocations) */
+	hpack_table_free(ctx);
+
+	return (ret);
+}
+
+struct hpack_decoder *
+hpack_decoder_new(struct hpack_table *hpack)
+{
+	const struct hpack_allocator	*alloc;
+	struct hpack_decoder		*hdc;
+
+	alloc = hpack == NULL ? hpack_allocator : hpack->htb_alloc;
+	if ((hdc = hpack_calloc(alloc, 1, sizeof(*hdc))) == NULL)
+		return (NULL);
+	if (hpack == NULL &&
+	    (hpack = hdc->hdc_ctx = hpack_table_new(0)) == NULL) {
+		hpack_free(alloc, hdc);
+		return (NULL);
+	}
+	hdc->hdc_alloc = alloc;
+	hdc->hdc_table = hpack;
+	hdc->hdc_max = HPACK_DECODER_MAX;
+
+	return (hdc);
+}
+
+void
+hpack_decoder_free(struct hpack_decoder *hdc)
+{
+	if (hdc == NULL)
+		return;
+	hpack_arena_free(hdc->hdc_arena);
+	hpack_freezero(hdc->hdc_alloc, hdc->hdc_buf, hdc->hdc_size);
+	hpack_table_free(hdc->hdc_ctx);
+	hpack_free(hdc->hdc_alloc, hdc);
+}
+
+int
+hpack_decoder_feed(struct hpack_decoder *hdc, unsigned char *data,
+    size_t len, struct hpack_headerblock *hdrs)
+{
+	struct hbuf			 hbuf;
+	unsigned char			*ptr;
+	size_t				 size, n;
+	int				 ret;
+
+	if (len > LONG_MAX || hdc->hdc_len > LONG_MAX - len)
+		return (-1);
+	hdc->hdc_table->htb_stats.hst_bytes_in += len;
+
+	/*
+	 * Append only the missing bytes of the incomplete field of the
+	 * previous fragments.  Its length is learned while it is decoded,
+	 * so it is retried until it is complete.
+	 */
+	while (hdc->hdc_len > 0 && len > 0) {
+		n = MIN(len, hdc->hdc_need - hdc->hdc_len);
+		if (hdc->hdc_len + n > hdc->hdc_size) {
+			size = MAX(hdc->hdc_len + n, hdc->hdc_size * 2);
+			if ((ptr = hpack_recallocarray(hdc->hdc_alloc,
+			    hdc->hdc_buf, hdc->hdc_size, size, 1)) == NULL)
 				return (-1);
-			if (hbuf_readchar(buf, &b) == -1 ||
-			    hbuf_advance(buf, 1) == -1)
+			hdc->hdc_buf = ptr;
+			hdc->hdc_size = size;
+		}
+		memcpy(hdc->hdc_buf + hdc->hdc_len, data, n);
+		hdc->hdc_len += n;
+		data += n;
+		len -= n;
+
+		/* Don't retry before the missing bytes have arrived */
+		if (hdc->hdc_len < hdc->hdc_need)
+			return (0);
+
+		/* The field ends exactly at the bytes that it needed */
+		hbuf_init(&hbuf, hdc->hdc_buf, hdc->hdc_len);
+		switch (hpack_decoder_field(hdc, &hbuf, hdrs)) {
+		case -1:
+			return (-1);
+		case 0:
+			hdc->hdc_need = hbuf.need;
+			break;
+		default:
+			hdc->hdc_len = hdc->hdc_need = 0;
+			break;
+		}
+	}
+
+	/* Decode the complete fields straight from the fragment */
+	hbuf_init(&hbuf, data, len);
+	while (hbuf_left(&hbuf) > 0) {
+		if ((ret = hpack_decoder_field(hdc, &hbuf, hdrs)) == -1)
+			return (-1);
+		if (ret == 0)
+			break;
+	}
+	if ((len -= hbuf.rpos) == 0)
+		return (0);
+
+	/* Keep the remaining bytes of the incomplete field */
+	if (len > hdc->hdc_size) {
+		if ((ptr = hpack_recallocarray(hdc->hdc_alloc,
+		    hdc->hdc_buf, hdc->hdc_size, len, 1)) == NULL)
+			return (-1);
+		hdc->hdc_buf = ptr;
+		hdc->hdc_size = len;
+	}
+	memcpy(hdc->hdc_buf, data + hbuf.rpos, len);
+	hdc->hdc_len = len;
+	hdc->hdc_need = hbuf.need - hbuf.rpos;
+
+	return (0);
+}
+
+static int
+hpack_decoder_field(struct hpack_decoder *hdc, struct hbuf *hbuf,
+    struct hpack_headerblock *hdrs)
+{
+	struct hpack_field		 hf;
+	struct hpack_ref		*ref;
+	size_t				 pos = hbuf->rpos;
+	int				 n;
+
+	hbuf->need = 0;
+	if ((n = hpack_decode_field(hbuf, &hf, 0, &ref,
+	    &hdc->hdc_arena, hdc->hdc_table)) == -1) {
+		/* Fail on errors other than a truncated field */
+		if (hbuf->need <= hbuf->wpos)
+			return (-1);
+
+		/* Don't buffer the declared length of huge fields */
+		if (hbuf->need - pos > hdc->hdc_max) {
+			DPRINTF("%s: field too large (%zu bytes)",
+			    __func__, hbuf->need - pos);
+			return (-1);
+		}
+
+		/* Rewind to the start of the incomplete field */
+		hbuf->rpos = pos;
+		DPRINTF("%s: incomplete field (%zu of %zu bytes)",
+		    __func__, hbuf->wpos - pos, hbuf->need - pos);
+		hpack_arena_reset(&hdc->hdc_arena);
+		return (0);
+	}
+	if (n == 1 && hpack_decode_header(hdrs, NULL, NULL, &hf,
+	    NULL, hdc->hdc_table) == -1)
+		return (-1);
+	hpack_arena_reset(&hdc->hdc_arena);
+
+	return (1);
+}
+
+int
+hpack_decoder_setmax(size_t max, struct hpack_decoder *hdc)
+{
+	if (max == 0)
+		return (-1);
+	hdc->hdc_max = max;
+	return (0);
+}
+
+int
+hpack_decoder_finish(struct hpack_decoder *hdc)
+{
+	int	 ret = 0;
+
+	/* The header block must not end within a field */
+	if (hdc->hdc_len > 0) {
+		DPRINTF("%s: truncated header block", __func__);
+		ret = -1;
+	}
+	hdc->hdc_len = hdc->hdc_need = 0;
+
+	return (ret);
+}
+
+struct hpack_fieldblock *
+hpack_decode_fields(unsigned char *data, size_t len,
+    struct hpack_table *hpack)
+{
+	return (hpack_decode_fieldblock(data, len, 0, hpack));
+}
+
+struct hpack_fieldblock *
+hpack_decode_fields_lazy(unsigned char *data, size_t len,
+    struct hpack_table *hpack)
+{
+	return (hpack_decode_fieldblock(data, len, 1, hpack));
+}
+
+int
+hpack_field_decode(struct hpack_fieldblock *hfb, struct hpack_field *hf)
+{
+	unsigned char	*str, cls;
+	ssize_t		 len;
+
+	if ((hf->hpf_flags & HPACK_FIELD_HUFFMAN) == 0)
+		return (0);
+
+	/* Decode the value into the arena once on first access */
+	if ((str = hpack_arena_alloc(hfb->hfb_alloc, &hfb->hfb_arena,
+	    HPACK_HUFFMAN_DECODE_MAX(hf->hpf_value_len))) == NULL)
+		return (-1);
+	if ((len = hpack_huffman_decode_buf(
+	    (const unsigned char *)hf->hpf_value,
+	    hf->hpf_value_len, str, &cls)) == -1 ||
+	    (cls & HPACK_CHAR_NUL)) {
+		hpack_arena_trim(&hfb->hfb_arena, str, 0);
+		return (-1);
+	}
+	hpack_arena_trim(&hfb->hfb_arena, str, (size_t)len);
+
+	hf->hpf_value = (const char *)str;
+	hf->hpf_value_len = (size_t)len;
+	hf->hpf_flags &= ~HPACK_FIELD_HUFFMAN;
+
+	return (0);
+}
+
+static struct hpack_fieldblock *
+hpack_decode_fieldblock(unsigned char *data, size_t len, int lazy,
+    struct hpack_table *hpack)
+{
+	struct hpack_fieldblock		*hfb = NULL;
+	struct hpack_field		 hf, *fields;
+	struct hpack_table		*ctx = NULL;
+	struct hpack_ref		*ref;
+	struct hpack_reflist		*hrl;
+	struct hbuf			 hbuf;
+	size_t				 size;
+	int				 ret = -1, n;
+
+	if (len == 0 || len > LONG_MAX)
+		goto fail;
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		goto fail;
+	if ((hfb = hpack_calloc(hpack->htb_alloc, 1, sizeof(*hfb))) == NULL)
+		goto fail;
+	hfb->hfb_alloc = hpack->htb_alloc;
+	hpack->htb_stats.hst_bytes_in += len;
+
+	hbuf_init(&hbuf, data, len);
+
+	do {
+		if ((n = hpack_decode_field(&hbuf, &hf, lazy, &ref,
+		    &hfb->hfb_arena, hpack)) == -1)
+			goto fail;
+		if (n == 0)
+			continue;
+
+		/* Indexed fields share the strings of the table entry */
+		if (ref != NULL) {
+			if ((hrl = hpack_arena_alloc(hfb->hfb_alloc,
+			    &hfb->hfb_arena, sizeof(*hrl))) == NULL)
+				goto fail;
+			hpack_ref_get(ref);
+			hrl->hrl_ref = ref;
+			hrl->hrl_next = hfb->hfb_refs;
+			hfb->hfb_refs = hrl;
+		}
+
+		/* Add field to the array */
+		if (hfb->hfb_nfields == hfb->hfb_size) {
+			size = hfb->hfb_size == 0 ?
+			    HPACK_FIELDS_SIZE : hfb->hfb_size * 2;
+			if ((fields = hpack_reallocarray(hfb->hfb_alloc,
+			    hfb->hfb_fields, size, sizeof(*fields))) == NULL)
+				goto fail;
+			hfb->hfb_fields = fields;
+			hfb->hfb_size = size;
+		}
+		memcpy(&hfb->hfb_fields[hfb->hfb_nfields++], &hf, sizeof(hf));
+
+		/* Optionally add to index */
+		if (hf.hpf_index == HPACK_INDEX &&
+		    hpack_table_add(&hf, hpack) == -1)
+			goto fail;
+	} while (hbuf_left(&hbuf) > 0);
+
+	ret = 0;
+ fail:
+	if (ret != 0) {
+		hpack_fieldblock_free(hfb);
+		hfb = NULL;
+	}
+
+	/* Free the local table (for single invocations) */
+	hpack_table_free(ctx);
+
+	return (hfb);
+}
+
+void
+hpack_fieldblock_free(struct hpack_fieldblock *hfb)
+{
+	struct hpack_reflist	*hrl;
+
+	if (hfb == NULL)
+		return;
+
+	/* Release the shared strings before the arena of the list */
+	for (hrl = hfb->hfb_refs; hrl != NULL; hrl = hrl->hrl_next)
+		hpack_ref_put(hrl->hrl_ref);
+	hpack_arena_free(hfb->hfb_arena);
+	hpack_free(hfb->hfb_alloc, hfb->hfb_fields);
+	hpack_free(hfb->hfb_alloc, hfb);
+}
+
+int
+hpack_decode_cb(unsigned char *data, size_t len, struct hpack_table *hpack,
+    int (*cb)(const struct hpack_field *, void *), void *arg)
+{
+	struct hpack_field		 hf;
+	struct hpack_ref		*ref;
+	struct hpack_arena		*arena = NULL;
+	struct hpack_table		*ctx = NULL;
+	struct hbuf			 hbuf;
+	int				 ret = -1, n;
+
+	if (len == 0 || len > LONG_MAX)
+		goto fail;
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		goto fail;
+	hpack->htb_stats.hst_bytes_in += len;
+
+	hbuf_init(&hbuf, data, len);
+
+	do {
+		/* Indexed fields point into the table while it is unchanged */
+		if ((n = hpack_decode_field(&hbuf, &hf, 0,
+		    &ref, &arena, hpack)) == -1)
+			goto fail;
+		if (n == 0)
+			continue;
+
+		/* Pass the field to the caller without copying it */
+		if (cb(&hf, arg) == -1)
+			goto fail;
+
+		/* Optionally add to index */
+		if (hf.hpf_index == HPACK_INDEX &&
+		    hpack_table_add(&hf, hpack) == -1)
+			goto fail;
+
+		/* The field is not used anymore, reuse the scratch memory */
+		hpack_arena_reset(&arena);
+	} while (hbuf_left(&hbuf) > 0);
+
+	ret = 0;
+ fail:
+	hpack_arena_free(arena);
+
+	/* Free the local table (for single invocations) */
+	hpack_table_free(ctx);
+
+	return (ret);
+}
+
+static int
+hpack_decode_header(struct hpack_headerblock *hdrs,
+    const struct hpack_allocator *alloc, struct hpack_arena **arena,
+    struct hpack_field *hf, struct hpack_pseudo *pseudo,
+    struct hpack_table *hpack)
+{
+	struct hpack_header	*hdr;
+	int			 n;
+
+	/*
+	 * The strings might point into the dynamic table, copy them
+	 * before the field is added to the table and evicts entries.
+	 * Decoded headers don't depend on the table.
+	 */
+	if (pseudo != NULL && hf->hpf_name_len > 0 &&
+	    hf->hpf_name[0] == ':' &&
+	    (n = hpack_decode_pseudo_field(alloc, arena, hf, pseudo)) != 0) {
+		/* Pseudo-headers are stored outside of the list */
+		if (n == -1)
+			return (-1);
+	} else {
+		if ((hdr = hpack_header_insert(hdrs, alloc, arena,
+		    hf->hpf_name, hf->hpf_name_len,
+		    hf->hpf_value, hf->hpf_value_len,
+		    hf->hpf_index)) == NULL)
+			return (-1);
+		hdr->hdr_token = hf->hpf_token;
+	}
+
+	/* Optionally add to index */
+	if (hf->hpf_index == HPACK_INDEX &&
+	    hpack_table_add(hf, hpack) == -1)
+		return (-1);
+
+	return (0);
+}
+
+static int
+hpack_decode_pseudo_field(const struct hpack_allocator *alloc,
+    struct hpack_arena **arena, struct hpack_field *hf,
+    struct hpack_pseudo *pseudo)
+{
+	struct hpack_view	*hpv;
+	char			*str;
+
+	switch (hf->hpf_token) {
+	case HPACK_TOKEN_METHOD:
+		hpv = &pseudo->hpp_method;
+		break;
+	case HPACK_TOKEN_SCHEME:
+		hpv = &pseudo->hpp_scheme;
+		break;
+	case HPACK_TOKEN_AUTHORITY:
+		hpv = &pseudo->hpp_authority;
+		break;
+	case HPACK_TOKEN_PATH:
+		hpv = &pseudo->hpp_path;
+		break;
+	case HPACK_TOKEN_STATUS:
+		hpv = &pseudo->hpp_status;
+		break;
+	default:
+		/* Other pseudo-headers are added to the list */
+		return (0);
+	}
+	if (hpv->hpv_str != NULL) {
+		DPRINTF("%s: duplicate pseudo-header %.*s", __func__,
+		    (int)hf->hpf_name_len, hf->hpf_name);
+		return (-1);
+	}
+
+	/* The value is owned by the arena of the header block */
+	if ((str = hpack_strdup(alloc, arena,
+	    hf->hpf_value, hf->hpf_value_len)) == NULL)
+		return (-1);
+	hpv->hpv_str = str;
+	hpv->hpv_len = hf->hpf_value_len;
+
+	if (hpv == &pseudo->hpp_method)
+		pseudo->hpp_method_id = hpack_method_parse(str, hpv->hpv_len);
+	else if (hpv == &pseudo->hpp_status && hpv->hpv_len == 3 &&
+	    str[0] >= '1' && str[0] <= '9' &&
+	    str[1] >= '0' && str[1] <= '9' &&
+	    str[2] >= '0' && str[2] <= '9')
+		pseudo->hpp_status_code =
+		    (str[0] - '0') * 100 + (str[1] - '0') * 10 + str[2] - '0';
+
+	return (1);
+}
+
+static enum hpack_method
+hpack_method_parse(const char *str, size_t len)
+{
+	static const char	*methods[] = {
+		[HPACK_METHOD_GET] =		"GET",
+		[HPACK_METHOD_HEAD] =		"HEAD",
+		[HPACK_METHOD_POST] =		"POST",
+		[HPACK_METHOD_PUT] =		"PUT",
+		[HPACK_METHOD_DELETE] =		"DELETE",
+		[HPACK_METHOD_CONNECT] =	"CONNECT",
+		[HPACK_METHOD_OPTIONS] =	"OPTIONS",
+		[HPACK_METHOD_TRACE] =		"TRACE",
+		[HPACK_METHOD_PATCH] =		"PATCH",
+	};
+	int			 i;
+
+	/* Methods are case-sensitive */
+	for (i = HPACK_METHOD_GET; i < HPACK_METHOD_OTHER; i++)
+		if (strlen(methods[i]) == len &&
+		    memcmp(methods[i], str, len) == 0)
+			return (i);
+
+	return (HPACK_METHOD_OTHER);
+}
+
+static long
+hpack_decode_int(struct hbuf *buf, unsigned char prefix)
+{
+	const unsigned char	*p = buf->data + buf->rpos;
+	uint64_t		 i;
+	size_t			 len, n;
+	unsigned char		 m = ~prefix;
+
+	/* Check the bounds once for the longest valid integer */
+	len = MIN(hbuf_left(buf), HPACK_INT_OCTETS + 1);
+	if (len == 0) {
+		buf->need = buf->rpos + 1;
+		return (-1);
+	}
+
+	/* Most integers fit into the prefix of the first octet */
+	if ((i = p[0] & m) < m) {
+		buf->rpos++;
+		return ((long)i);
+	}
+
+	/* Add the varint bits while the 0x80 bit is set */
+	for (n = 1; n < len; n++) {
+		i += (uint64_t)(p[n] & 0x7f) << (7 * (n - 1));
+		if ((p[n] & 0x80) == 0) {
+			if (i > HPACK_INT_MAX) {
+				DPRINTF("%s: integer too large", __func__);
 				return (-1);
-			i += (b & ~0x80) << m;
-			m += 7;
-		} while (b & 0x80);
+			}
+			buf->rpos += n + 1;
+			return ((long)i);
+		}
 	}
 
-	return ((long)i);
+	/* The integer is truncated or longer than the limit */
+	if (len <= HPACK_INT_OCTETS)
+		buf->need = buf->rpos + len + 1;
+	else
+		DPRINTF("%s: integer too long", __func__);
+
+	return (-1);
 }
 
 static long
 hpack_decode_index(struct hbuf *buf, unsigned char prefix,
-    const struct hpack_index **idptr, struct hpack_table *hpack)
+    struct hpack_field *hf, int withvalue, struct hpack_ref **refp,
+    struct hpack_arena **arena, struct hpack_table *hpack)
 {
 	struct hpack_index		 idbuf;
-	struct hpack_header		*hdr = hpack->htb_next;
 	const struct hpack_index	*id;
 	long				 i;
-	int				 hasvalue;
-
-	if (idptr != NULL)
-		*idptr = NULL;
 
 	if ((i = hpack_decode_int(buf, prefix)) == -1)
 		return (-1);
@@ -436,108 +1675,397 @@ hpack_decode_index(struct hbuf *buf, unsigned char prefix,
 		return (-1);
 	}
 
-	if (hdr == NULL || hdr->hdr_name != NULL || hdr->hdr_value != NULL)
-		errx(1, "invalid header");
-
-	if ((hdr->hdr_name = strdup(id->hpi_name)) == NULL)
-		return (-1);
-	hasvalue = id->hpi_value == NULL ? 0 : 1;
-	if (hasvalue &&
-	    (hdr->hdr_value = strdup(id->hpi_value)) == NULL) {
-		free(hdr->hdr_name);
-		hdr->hdr_name = NULL;
-		return (-1);
+	/*
+	 * Strings of the static table are constant but entries of the
+	 * dynamic table might be evicted while decoding the block.
+	 * The caller can borrow the strings with the returned reference
+	 * instead of copying them if it uses them before the next
+	 * change of the table.
+	 */
+	hf->hpf_name = id->hpi_name;
+	hf->hpf_name_len = id->hpi_name_len;
+	hf->hpf_token = i > (long)HPACK_STATIC_SIZE ?
+	    id->hpi_token : (enum hpack_token)static_token[i];
+	if (withvalue && id->hpi_value != NULL) {
+		hf->hpf_value = id->hpi_value;
+		hf->hpf_value_len = id->hpi_value_len;
 	}
+	if (refp != NULL)
+		*refp = id->hpi_ref;
+	else if (i > (long)HPACK_STATIC_SIZE &&
+	    (hpack_arena_copy(hpack->htb_alloc, arena,
+	    &hf->hpf_name, hf->hpf_name_len) == -1 ||
+	    (hf->hpf_value != NULL && hpack_arena_copy(hpack->htb_alloc,
+	    arena, &hf->hpf_value, hf->hpf_value_len) == -1)))
+		return (-1);
 
 	DPRINTF("%s: index: %ld (%s%s%s)", __func__,
 	    i, id->hpi_name,
-	    hasvalue ? ": " : "",
-	    hasvalue ? id->hpi_value : "");
-
-	if (idptr != NULL)
-		*idptr = id;
+	    hf->hpf_value != NULL ? ": " : "",
+	    hf->hpf_value != NULL ? id->hpi_value : "");
 
 	return (i);
 }
 
-static char *
-hpack_decode_str(struct hbuf *buf, unsigned char prefix)
+static int
+hpack_decode_str(struct hbuf *buf, unsigned char prefix,
+    const char **strp, size_t *lenp, unsigned int *flagsp, int name,
+    struct hpack_arena **arena, struct hpack_table *hpack)
 {
 	long		 i;
-	unsigned char	*ptr, c;
-	char		*str;
+	ssize_t		 len;
+	size_t		 pos;
+	unsigned char	*ptr, *str, c, cls, reject = HPACK_CHAR_NUL;
 
 	if (hbuf_readchar(buf, &c) == -1)
-		return (NULL);
+		return (-1);
 	if ((i = hpack_decode_int(buf, prefix)) == -1)
-		return (NULL);
+		return (-1);
 	if (hbuf_readbuf(buf, &ptr, (size_t)i) == -1 ||
 	    hbuf_advance(buf, (size_t)i) == -1)
-		return (NULL);
-	if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN) {
+		return (-1);
+
+	/* Names and values have different sets of invalid characters */
+	if (hpack->htb_validate)
+		reject |= name ?
+		    HPACK_CHAR_NAME | HPACK_CHAR_UPPER : HPACK_CHAR_VALUE;
+
+	/* Values are decoded immediately if they have to be validated */
+	if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN &&
+	    flagsp != NULL && !hpack->htb_validate) {
+		/* Keep the code in the input buffer to decode it later */
+		DPRINTF("%s: deferring huffman code (size %ld)", __func__, i);
+
+		/* But reject invalid code and NUL without any output */
+		if (hpack_huffman_check(ptr, (size_t)i, &cls) == -1 ||
+		    (cls & HPACK_CHAR_NUL)) {
+			DPRINTF("%s: invalid huffman code", __func__);
+			return (-1);
+		}
+		*strp = (const char *)ptr;
+		*lenp = (size_t)i;
+		*flagsp |= HPACK_FIELD_HUFFMAN;
+		hpack->htb_stats.hst_huffman++;
+	} else if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN) {
 		DPRINTF("%s: decoding huffman code (size %ld)", __func__, i);
-		if ((str = hpack_huffman_decode_str(ptr, (size_t)i)) == NULL)
-			return (NULL);
+		if ((str = hpack_arena_alloc(hpack->htb_alloc, arena,
+		    HPACK_HUFFMAN_DECODE_MAX((size_t)i))) == NULL)
+			return (-1);
+		if ((len = hpack_huffman_decode_buf(ptr,
+		    (size_t)i, str, &cls)) == -1)
+			return (-1);
+		hpack_arena_trim(arena, str, (size_t)len);
+
+		/*
+		 * The classes of the characters are collected while
+		 * decoding, the string is only scanned again to find the
+		 * position of the first invalid character.
+		 */
+		if ((cls & reject) != 0) {
+			cls = hpack_validate(str, (size_t)len, reject, &pos);
+			hpack_validate_error(hpack, cls, name,
+			    (size_t)(ptr - buf->data), str, pos);
+			return (-1);
+		}
+
+		*strp = (const char *)str;
+		*lenp = (size_t)len;
+		hpack->htb_stats.hst_huffman++;
+		if (len > i)
+			hpack->htb_stats.hst_huffman_saved += len - i;
 	} else {
-		if ((str = calloc(1, (size_t)i + 1)) == NULL)
-			return (NULL);
-		memcpy(str, ptr, (size_t)i);
+		/* Raw strings point into the input buffer, without NUL */
+		if ((cls = hpack_validate(ptr, (size_t)i, reject, &pos)) != 0) {
+			hpack_validate_error(hpack, cls, name,
+			    (size_t)(ptr - buf->data), ptr, pos);
+			return (-1);
+		}
+		*strp = (const char *)ptr;
+		*lenp = (size_t)i;
+		hpack->htb_stats.hst_raw++;
 	}
-	return (str);
+	return (0);
 }
 
-static int
+/* Implementations of the vectorized kernels, in order of preference */
+enum hpack_simd {
+	HPACK_SIMD_SCALAR,
+	HPACK_SIMD_SSE2,
+	HPACK_SIMD_AVX2,
+	HPACK_SIMD_AVX512
+};
+
+static const struct hpack_kernel {
+	const char	*hk_name;
+	size_t		(*hk_validate)(const unsigned char *, size_t,
+			    unsigned char);
+} hpack_kernels[] = {
+	[HPACK_SIMD_SCALAR] =	{ "scalar",	hpack_validate_scalar },
+#ifdef HPACK_SIMD_X86
+	[HPACK_SIMD_SSE2] =	{ "sse2",	hpack_validate_sse2 },
+	[HPACK_SIMD_AVX2] =	{ "avx2",	hpack_validate_avx2 },
+	[HPACK_SIMD_AVX512] =	{ "avx512",	hpack_validate_avx512 },
+#endif
+};
+
+static size_t
+hpack_validate_init(const unsigned char *str, size_t len,
+    unsigned char reject)
+{
+	/*
+	 * Without hpack_init(), concurrent first calls might resolve the
+	 * kernel more than once, but they atomically store the same one.
+	 */
+	hpack_validate_setup();
+
+	return (atomic_load_explicit(&hpack_validate_prefix,
+	    memory_order_relaxed)(str, len, reject));
+}
+
+static void
+hpack_validate_setup(void)
+{
+	enum hpack_simd	 simd = HPACK_SIMD_SCALAR;
+	const char	*env;
+	size_t		 i;
+
+#ifdef HPACK_SIMD_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512bw"))
+		simd = HPACK_SIMD_AVX512;
+	else if (__builtin_cpu_supports("avx2"))
+		simd = HPACK_SIMD_AVX2;
+	else if (__builtin_cpu_supports("sse2"))
+		simd = HPACK_SIMD_SSE2;
+#endif
+
+	/* For debugging, fall back to a kernel that the CPU supports */
+	if ((env = getenv("HPACK_SIMD")) != NULL) {
+		for (i = 0; i <= simd; i++) {
+			if (strcmp(env, hpack_kernels[i].hk_name) == 0) {
+				simd = i;
+				break;
+			}
+		}
+	}
+	DPRINTF("%s: %s", __func__, hpack_kernels[simd].hk_name);
+
+	atomic_store_explicit(&hpack_validate_prefix,
+	    hpack_kernels[simd].hk_validate, memory_order_relaxed);
+}
+
+static unsigned char
+hpack_validate(const unsigned char *str, size_t len, unsigned char reject,
+    size_t *posp)
+{
+	unsigned char	 cls;
+	size_t		 i;
+
+	/* Skip the longest prefix that is known to be valid */
+	i = atomic_load_explicit(&hpack_validate_prefix,
+	    memory_order_relaxed)(str, len, reject);
+
+	/* Find the first invalid character in the remaining tail */
+	for (; i < len; i++) {
+		if ((cls = char_class[str[i]] & reject) != 0)
+			break;
+	}
+	*posp = i;
+
+	return (i < len ? cls : 0);
+}
+
+static void
+hpack_validate_error(struct hpack_table *hpack, unsigned char cls, int name,
+    size_t offset, const unsigned char *str, size_t pos)
+{
+	struct hpack_error	*hpe = &hpack->htb_error;
+
+	if (name)
+		hpe->hpe_code = (cls & HPACK_CHAR_UPPER) ?
+		    HPACK_ERR_NAME_UPPERCASE : HPACK_ERR_NAME_CHAR;
+	else
+		hpe->hpe_code = HPACK_ERR_VALUE_CHAR;
+	hpe->hpe_offset = offset;
+	hpe->hpe_pos = pos;
+	hpe->hpe_char = str[pos];
+
+	DPRINTF("%s: invalid %s character 0x%02x at %zu", __func__,
+	    name ? "name" : "value", hpe->hpe_char, pos);
+}
+
+static size_t
+hpack_validate_scalar(const unsigned char *str, size_t len,
+    unsigned char reject)
+{
+	/* The scalar loop in hpack_validate() checks all characters */
+	return (0);
+}
+
+#ifdef HPACK_SIMD_X86
+__attribute__((__target__("avx512bw")))
+static size_t
+hpack_validate_avx512(const unsigned char *str, size_t len,
+    unsigned char reject)
+{
+	__m512i		 v;
+	__mmask64	 m;
+	size_t		 i;
+
+	/* Like the AVX2 version, 64 characters at a time into a mask */
+	for (i = 0; i + 64 <= len; i += 64) {
+		v = _mm512_loadu_si512((const void *)(str + i));
+		if (reject & HPACK_CHAR_NAME)
+			m = _mm512_cmplt_epi8_mask(v,
+			    _mm512_set1_epi8(' ' + 1)) |
+			    _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(0x7f));
+		else if (reject & HPACK_CHAR_VALUE)
+			m = _mm512_cmpeq_epi8_mask(v, _mm512_setzero_si512()) |
+			    _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('\r')) |
+			    _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('\n'));
+		else
+			m = _mm512_cmpeq_epi8_mask(v, _mm512_setzero_si512());
+		if (reject & HPACK_CHAR_UPPER)
+			m |= _mm512_cmpgt_epi8_mask(v,
+			    _mm512_set1_epi8('A' - 1)) &
+			    _mm512_cmplt_epi8_mask(v,
+			    _mm512_set1_epi8('Z' + 1));
+		if (m != 0)
+			break;
+	}
+
+	return (i);
+}
+
+__attribute__((__target__("avx2")))
+static size_t
+hpack_validate_avx2(const unsigned char *str, size_t len,
+    unsigned char reject)
+{
+	__m256i		 v, m;
+	size_t		 i;
+
+	/*
+	 * Compare 32 characters at a time and return the length of the
+	 * valid prefix, the block with an invalid character is left to
+	 * the scalar loop to find its exact position.  The comparisons
+	 * are signed: characters >= 0x80 are negative and below ' ' + 1.
+	 */
+	for (i = 0; i + 32 <= len; i += 32) {
+		v = _mm256_loadu_si256((const __m256i *)(str + i));
+		if (reject & HPACK_CHAR_NAME)
+			m = _mm256_or_si256(
+			    _mm256_cmpgt_epi8(_mm256_set1_epi8(' ' + 1), v),
+			    _mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x7f)));
+		else if (reject & HPACK_CHAR_VALUE)
+			m = _mm256_or_si256(
+			    _mm256_cmpeq_epi8(v, _mm256_setzero_si256()),
+			    _mm256_or_si256(
+			    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')),
+			    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+		else
+			m = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+		if (reject & HPACK_CHAR_UPPER)
+			m = _mm256_or_si256(m, _mm256_and_si256(
+			    _mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)),
+			    _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v)));
+		if (_mm256_movemask_epi8(m) != 0)
+			break;
+	}
+
+	return (i);
+}
+
+__attribute__((__target__("sse2")))
+static size_t
+hpack_validate_sse2(const unsigned char *str, size_t len,
+    unsigned char reject)
+{
+	__m128i		 v, m;
+	size_t		 i;
+
+	/* Like the AVX2 version, 16 characters at a time */
+	for (i = 0; i + 16 <= len; i += 16) {
+		v = _mm_loadu_si128((const __m128i *)(str + i));
+		if (reject & HPACK_CHAR_NAME)
+			m = _mm_or_si128(
+			    _mm_cmplt_epi8(v, _mm_set1_epi8(' ' + 1)),
+			    _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f)));
+		else if (reject & HPACK_CHAR_VALUE)
+			m = _mm_or_si128(
+			    _mm_cmpeq_epi8(v, _mm_setzero_si128()),
+			    _mm_or_si128(
+			    _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+			    _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+		else
+			m = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+		if (reject & HPACK_CHAR_UPPER)
+			m = _mm_or_si128(m, _mm_and_si128(
+			    _mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+			    _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1))));
+		if (_mm_movemask_epi8(m) != 0)
+			break;
+	}
+
+	return (i);
+}
+#endif
+
+static long
 hpack_decode_literal(struct hbuf *buf, unsigned char prefix,
+    struct hpack_field *hf, int lazy, struct hpack_arena **arena,
     struct hpack_table *hpack)
 {
-	struct hpack_header		*hdr = hpack->htb_next;
-	const struct hpack_index	*id;
 	long				 i;
-	char				*str;
 
-	if ((i = hpack_decode_index(buf, prefix, &id, hpack)) == -1)
+	if ((i = hpack_decode_index(buf, prefix, hf, 0,
+	    NULL, arena, hpack)) == -1)
 		return (-1);
 
 	if (i == 0) {
-		if (hdr == NULL ||
-		    hdr->hdr_name != NULL || hdr->hdr_value != NULL)
-			errx(1, "invalid header");
-
-		if ((str = hpack_decode_str(buf,
-		    HPACK_M_LITERAL)) == NULL)
+		if (hpack_decode_str(buf, HPACK_M_LITERAL,
+		    &hf->hpf_name, &hf->hpf_name_len, NULL, 1,
+		    arena, hpack) == -1)
 			return (-1);
-		DPRINTF("%s: name: %s", __func__, str);
-		hdr->hdr_name = str;
-	}
+		DPRINTF("%s: name: %.*s", __func__,
+		    (int)hf->hpf_name_len, hf->hpf_name);
 
-	/* The index might have set a default value */
-	if (hdr->hdr_value != NULL) {
-		free(hdr->hdr_value);
-		hdr->hdr_value = NULL;
+		/* Literal names can still be one of the well-known names */
+		hf->hpf_token = hpack_token_getbyname(hf->hpf_name,
+		    hf->hpf_name_len);
 	}
 
-	if ((str = hpack_decode_str(buf, HPACK_M_LITERAL)) == NULL)
+	/* Only values can be decoded lazily, the name is always needed */
+	if (hpack_decode_str(buf, HPACK_M_LITERAL,
+	    &hf->hpf_value, &hf->hpf_value_len,
+	    lazy ? &hf->hpf_flags : NULL, 0, arena, hpack) == -1)
 		return (-1);
-	DPRINTF("%s: value: %s", __func__, str);
-	hdr->hdr_value = str;
+	DPRINTF("%s: value: %.*s", __func__,
+	    (int)hf->hpf_value_len, hf->hpf_value);
 
-	return (0);
+	return (i);
 }
 
 static int
-hpack_decode_buf(struct hbuf *buf, struct hpack_table *hpack)
+hpack_decode_field(struct hbuf *buf, struct hpack_field *hf, int lazy,
+    struct hpack_ref **refp, struct hpack_arena **arena,
+    struct hpack_table *hpack)
 {
-	struct hpack_header	*hdr = NULL;
+	struct hpack_stats	*hst = &hpack->htb_stats;
+	size_t			 huffman = hst->hst_huffman;
+	size_t			 raw = hst->hst_raw;
+	size_t			 saved = hst->hst_huffman_saved;
 	unsigned char		 c;
 	long			 i;
 
-	if (hbuf_readchar(buf, &c) == -1)
-		goto fail;
+	memset(hf, 0, sizeof(*hf));
+	hf->hpf_index = HPACK_NO_INDEX;
+	if (refp != NULL)
+		*refp = NULL;
+	hpack->htb_error.hpe_code = HPACK_ERR_NONE;
 
-	if ((hdr = hpack_header_new()) == NULL)
+	if (hbuf_readchar(buf, &c) == -1)
 		goto fail;
-	hdr->hdr_index = HPACK_NO_INDEX;
-	hpack->htb_next = hdr;
 
 	/* 6.1 Indexed Header Field Representation */
 	if ((c & HPACK_M_INDEX) == HPACK_F_INDEX) {
@@ -545,13 +2073,12 @@ hpack_decode_buf(struct hbuf *buf, struct hpack_table *hpack)
 
 		/* 7 bit index */
 		if ((i = hpack_decode_index(buf,
-		    HPACK_M_INDEX, NULL, hpack)) == -1)
+		    HPACK_M_INDEX, hf, 1, refp, arena, hpack)) == -1)
 			goto fail;
 
 		/* No value means header with empty value */
-		if ((hdr->hdr_value == NULL) &&
-		    (hdr->hdr_value = strdup("")) == NULL)
-			goto fail;
+		if (hf->hpf_value == NULL)
+			hf->hpf_value = "";
 	}
 
 	/* 6.2.1. Literal Header Field with Incremental Indexing */
@@ -559,10 +2086,11 @@ hpack_decode_buf(struct hbuf *buf, struct hpack_table *hpack)
 		DPRINTF("%s: 0x%02x: 6.2.1 literal indexed", __func__, c);
 
 		/* 6 bit index */
-		if (hpack_decode_literal(buf,
-		    HPACK_M_LITERAL_INDEX, hpack) == -1)
+		/* The dynamic table needs the decoded value */
+		if ((i = hpack_decode_literal(buf,
+		    HPACK_M_LITERAL_INDEX, hf, 0, arena, hpack)) == -1)
 			goto fail;
-		hdr->hdr_index = HPACK_INDEX;
+		hf->hpf_index = HPACK_INDEX;
 	}
 
 	/* 6.2.2. Literal Header Field without Indexing */
@@ -570,87 +2098,292 @@ hpack_decode_buf(struct hbuf *buf, struct hpack_table *hpack)
 		DPRINTF("%s: 0x%02x: 6.2.2 literal", __func__, c);
 
 		/* 4 bit index */
-		if (hpack_decode_literal(buf,
-		    HPACK_M_LITERAL_NO_INDEX, hpack) == -1)
+		if ((i = hpack_decode_literal(buf,
+		    HPACK_M_LITERAL_NO_INDEX, hf, lazy, arena, hpack)) == -1)
 			goto fail;
 	}
 
 	/* 6.2.3. Literal Header Field Never Indexed */
-	else if ((c & HPACK_M_LITERAL_NO_INDEX) == HPACK_F_LITERAL_NO_INDEX) {
+	else if ((c & HPACK_M_LITERAL_NEVER_INDEX) ==
+	    HPACK_F_LITERAL_NEVER_INDEX) {
 		DPRINTF("%s: 0x%02x: 6.2.3 literal never indexed", __func__, c);
 
 		/* 4 bit index */
-		if (hpack_decode_literal(buf,
-		    HPACK_M_LITERAL_NO_INDEX, hpack) == -1)
+		if ((i = hpack_decode_literal(buf,
+		    HPACK_M_LITERAL_NEVER_INDEX, hf, lazy, arena, hpack)) == -1)
+			goto fail;
+		hf->hpf_index = HPACK_NEVER_INDEX;
+	}
+
+	/* 6.3. Dynamic Table Size Update */
+	else if ((c & HPACK_M_TABLE_SIZE_UPDATE) == HPACK_F_TABLE_SIZE_UPDATE) {
+		DPRINTF("%s: 0x%02x: 6.3 dynamic table update", __func__, c);
+
+		/* 5 bit index */
+		if ((i = hpack_decode_int(buf,
+		    HPACK_M_TABLE_SIZE_UPDATE)) == -1)
 			goto fail;
-		hdr->hdr_index = HPACK_NEVER_INDEX;
+
+		if (hpack_table_setsize(i, hpack) == -1)
+			goto fail;
+
+		return (0);
+	}
+
+	/* unknown index */
+	else {
+		DPRINTF("%s: 0x%02x: unknown index", __func__, c);
+		goto fail;
+	}
+
+	if (hf->hpf_name == NULL || hf->hpf_value == NULL)
+		goto fail;
+
+	if ((c & HPACK_M_INDEX) == HPACK_F_INDEX) {
+		if (i > (long)HPACK_STATIC_SIZE)
+			hst->hst_dynamic_hits++;
+		else
+			hst->hst_static_hits++;
+	} else if (i > 0)
+		hst->hst_name_hits++;
+	else
+		hst->hst_literals++;
+
+	return (1);
+ fail:
+	/* Don't count the strings of a field that is decoded again */
+	hst->hst_huffman = huffman;
+	hst->hst_raw = raw;
+	hst->hst_huffman_saved = saved;
+	DPRINTF("%s: failed", __func__);
+	return (-1);
+}
+
+unsigned char *
+hpack_encode(struct hpack_headerblock *hdrs, size_t *encoded_len,
+    struct hpack_table *hpack)
+{
+	return (hpack_encode_alloc(hdrs, NULL, 0, encoded_len, hpack));
+}
+
+int
+hpack_encode_buf(struct hpack_headerblock *hdrs, unsigned char *data,
+    size_t len, size_t *encoded_len, struct hpack_table *hpack)
+{
+	return (hpack_encode_data(hdrs, NULL, 0,
+	    data, len, encoded_len, hpack));
+}
+
+unsigned char *
+hpack_encode_fields(const struct hpack_field *fields, size_t nfields,
+    size_t *encoded_len, struct hpack_table *hpack)
+{
+	return (hpack_encode_alloc(NULL, fields, nfields, encoded_len, hpack));
+}
+
+int
+hpack_encode_fields_buf(const struct hpack_field *fields, size_t nfields,
+    unsigned char *data, size_t len, size_t *encoded_len,
+    struct hpack_table *hpack)
+{
+	return (hpack_encode_data(NULL, fields, nfields,
+	    data, len, encoded_len, hpack));
+}
+
+static unsigned char *
+hpack_encode_alloc(struct hpack_headerblock *hdrs,
+    const struct hpack_field *fields, size_t nfields, size_t *encoded_len,
+    struct hpack_table *hpack)
+{
+	struct hpack_table		*ctx = NULL;
+	struct hbuf			*hbuf = NULL;
+	size_t				 size = BUFSIZ;
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		goto fail;
+
+	/*
+	 * The fields of the caller are checked before the dynamic table
+	 * is updated, like on the buffer path, and the bound of the
+	 * fields is the size of the buffer that never has to grow.
+	 */
+	if (fields != NULL &&
+	    hpack_encode_bound(NULL, fields, nfields, &size, hpack) == -1)
+		goto fail;
+
+	if ((hbuf = hbuf_new(NULL, size)) == NULL)
+		goto fail;
+
+	if (hpack_encode_hdrs(hbuf, hdrs, fields, nfields, hpack) == -1)
+		goto fail;
+
+	hpack_table_free(ctx);
+	return (hbuf_release(hbuf, encoded_len));
+ fail:
+	hpack_table_free(ctx);
+	hbuf_free(hbuf);
+	return (NULL);
+}
+
+static int
+hpack_encode_data(struct hpack_headerblock *hdrs,
+    const struct hpack_field *fields, size_t nfields, unsigned char *data,
+    size_t len, size_t *encoded_len, struct hpack_table *hpack)
+{
+	struct hpack_table		*ctx = NULL;
+	struct hbuf			 hbuf;
+	size_t				 size;
+	int				 ret = -1;
+
+	*encoded_len = 0;
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		goto done;
+
+	/*
+	 * Check the worst-case size before encoding anything, the
+	 * dynamic table must not be updated if the buffer is too small.
+	 */
+	if (hpack_encode_bound(hdrs, fields, nfields, &size, hpack) == -1)
+		goto done;
+	if (size > len) {
+		DPRINTF("%s: buffer too small (%zu < %zu)",
+		    __func__, len, size);
+		*encoded_len = size;
+		goto done;
 	}
 
-	/* 6.3. Dynamic Table Size Update */
-	else if ((c & HPACK_M_TABLE_SIZE_UPDATE) == HPACK_F_TABLE_SIZE_UPDATE) {
-		DPRINTF("%s: 0x%02x: 6.3 dynamic table update", __func__, c);
+	/* Write into the caller's buffer without growing it */
+	hbuf_init(&hbuf, data, len);
+	hbuf.wpos = 0;
 
-		/* 5 bit index */
-		if ((i = hpack_decode_int(buf,
-		    HPACK_M_TABLE_SIZE_UPDATE)) == -1)
-			goto fail;
+	if (hpack_encode_hdrs(&hbuf, hdrs, fields, nfields, hpack) == -1)
+		goto done;
+	*encoded_len = hbuf.wpos;
 
-		if (hpack_table_setsize(i, hpack) == -1)
-			goto fail;
+	ret = 0;
+ done:
+	hpack_table_free(ctx);
+	return (ret);
+}
 
+static int
+hpack_encode_next(struct hpack_field *hf, struct hpack_header **hdrp,
+    const struct hpack_field *fields, size_t nfields, size_t *np)
+{
+	struct hpack_header		*hdr = *hdrp;
+
+	if (hdr != NULL) {
+		/* Get the lengths once, they are optional for new headers */
+		hf->hpf_name = hdr->hdr_name;
+		hf->hpf_name_len = HPACK_HDR_LEN(hdr->hdr_name,
+		    hdr->hdr_name_len);
+		hf->hpf_value = hdr->hdr_value;
+		hf->hpf_value_len = HPACK_HDR_LEN(hdr->hdr_value,
+		    hdr->hdr_value_len);
+		hf->hpf_index = hdr->hdr_index;
+		hf->hpf_flags = 0;
+		*hdrp = TAILQ_NEXT(hdr, hdr_entry);
+	} else if (*np < nfields) {
+		/* Fields of the caller are read in place with their lengths */
+		*hf = fields[(*np)++];
+	} else
 		return (0);
-	}
+	hf->hpf_token = HPACK_TOKEN_UNKNOWN;
 
-	/* unknown index */
-	else {
-		DPRINTF("%s: 0x%02x: unknown index", __func__, c);
-		goto fail;
-	}
+	return (1);
+}
 
-	if (hdr->hdr_name == NULL || hdr->hdr_value == NULL)
-		goto fail;
+static int
+hpack_encode_bound(struct hpack_headerblock *hdrs,
+    const struct hpack_field *fields, size_t nfields, size_t *boundp,
+    struct hpack_table *hpack)
+{
+	struct hpack_header		*hdr;
+	struct hpack_field		 hf;
+	size_t				 bound = 0, size, n = 0;
+	long				 maxid;
+	unsigned char			 cls;
 
-	/* Optionally add to index */
-	if (hpack_table_add(hdr, hpack) == -1)
-		goto fail;
+	/* Each entry of the dynamic table has at least 32 octets */
+	maxid = HPACK_STATIC_SIZE + hpack->htb_max_table_size / 32;
 
-	/* Add header to the list */
-	TAILQ_INSERT_TAIL(hpack->htb_headers, hdr, hdr_entry);
-	hpack->htb_next = NULL;
+	hdr = hdrs == NULL ? NULL : TAILQ_FIRST(hdrs);
+	while (hpack_encode_next(&hf, &hdr, fields, nfields, &n)) {
+		/*
+		 * Don't forward Huffman code that the peer has to reject
+		 * or unknown representations, they are checked before any
+		 * field of the block is indexed.
+		 */
+		if (hf.hpf_index != HPACK_NO_INDEX &&
+		    hf.hpf_index != HPACK_NEVER_INDEX &&
+		    hf.hpf_index != HPACK_INDEX) {
+			DPRINTF("%s: invalid index %d", __func__, hf.hpf_index);
+			return (-1);
+		}
+		if ((hf.hpf_flags & HPACK_FIELD_HUFFMAN) &&
+		    (hpack_huffman_check((const unsigned char *)hf.hpf_value,
+		    hf.hpf_value_len, &cls) == -1 || (cls & HPACK_CHAR_NUL))) {
+			DPRINTF("%s: invalid huffman code", __func__);
+			return (-1);
+		}
 
-	return (0);
- fail:
-	DPRINTF("%s: failed", __func__);
-	hpack_header_free(hdr);
-	hpack->htb_next = NULL;
+		/*
+		 * The strings are encoded exactly like the encoder does,
+		 * only the index and the indexing decisions of the
+		 * table are unknown and assumed to be the worst case.
+		 */
+		size = hpack_encode_intlen(maxid, HPACK_M_LITERAL_NO_INDEX);
+		size += hpack_encode_strlen(hf.hpf_name,
+		    hf.hpf_name_len, 0);
+		size += hpack_encode_strlen(hf.hpf_value,
+		    hf.hpf_value_len, hf.hpf_flags);
 
-	return (-1);
+		if (bound > SIZE_MAX - size)
+			return (-1);
+		bound += size;
+	}
+	*boundp = bound;
+
+	return (0);
 }
 
-unsigned char *
-hpack_encode(struct hpack_headerblock *hdrs, size_t *encoded_len,
+static int
+hpack_encode_hdrs(struct hbuf *hbuf, struct hpack_headerblock *hdrs,
+    const struct hpack_field *fields, size_t nfields,
     struct hpack_table *hpack)
 {
 	const struct hpack_index	*id;
 	struct hpack_index		 idbuf;
-	struct hpack_table		*ctx = NULL;
 	struct hpack_header		*hdr;
-	struct hbuf			*hbuf = NULL;
+	struct hpack_field		 hf;
+	enum hpack_header_index		 index;
 	unsigned char			 mask, flag;
-
-	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
-		goto fail;
-
-	if ((hbuf = hbuf_new(NULL, BUFSIZ)) == NULL)
-		goto fail;
-
-	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
-		DPRINTF("%s: header %s: %s (index %d)", __func__,
-		    hdr->hdr_name,
-		    hdr->hdr_value == NULL ? "(null)" : hdr->hdr_value,
-		    hdr->hdr_index);
-
-		switch (hdr->hdr_index) {
+	size_t				 start = hbuf->wpos, n = 0;
+
+	hdr = hdrs == NULL ? NULL : TAILQ_FIRST(hdrs);
+	while (hpack_encode_next(&hf, &hdr, fields, nfields, &n)) {
+		DPRINTF("%s: header %.*s: %.*s (index %d)", __func__,
+		    (int)hf.hpf_name_len, hf.hpf_name,
+		    (int)hf.hpf_value_len,
+		    hf.hpf_value == NULL ? "(null)" : hf.hpf_value,
+		    hf.hpf_index);
+
+		id = hpack_table_getbyheader(&hf, &idbuf, hpack);
+
+		/* Values that are still Huffman-encoded are not indexed */
+		index = hf.hpf_index;
+		if (index == HPACK_INDEX &&
+		    (hf.hpf_flags & HPACK_FIELD_HUFFMAN))
+			index = HPACK_NO_INDEX;
+
+		/* The admission policy might decide to not index it */
+		if (index == HPACK_INDEX && hpack->htb_sketch != NULL &&
+		    hf.hpf_name != NULL && hf.hpf_value != NULL &&
+		    !hpack_table_admit(&hf, hpack))
+			index = HPACK_NO_INDEX;
+
+		switch (index) {
 		case HPACK_INDEX:
 			mask = HPACK_M_LITERAL_INDEX;
 			flag = HPACK_F_LITERAL_INDEX;
@@ -663,10 +2396,11 @@ hpack_encode(struct hpack_headerblock *hdrs, size_t *encoded_len,
 			mask = HPACK_M_LITERAL_NEVER_INDEX;
 			flag = HPACK_F_LITERAL_NEVER_INDEX;
 			break;
+		default:
+			DPRINTF("%s: invalid index %d", __func__, index);
+			return (-1);
 		}
 
-		id = hpack_table_getbyheader(hdr, &idbuf, hpack);
-
 		/* 6.1 Indexed Header Field Representation */
 		if (id != NULL && id->hpi_value != NULL) {
 			DPRINTF("%s: index %zu (%s: %s)", __func__,
@@ -675,203 +2409,331 @@ hpack_encode(struct hpack_headerblock *hdrs, size_t *encoded_len,
 			    id->hpi_value == NULL ? "(null)" : id->hpi_value);
 			if (hpack_encode_int(hbuf, id->hpi_id,
 			    HPACK_M_INDEX, HPACK_F_INDEX) == -1)
-				goto fail;
+				return (-1);
+			if (id->hpi_id > (long)HPACK_STATIC_SIZE)
+				hpack->htb_stats.hst_dynamic_hits++;
+			else
+				hpack->htb_stats.hst_static_hits++;
 			continue;
 		}
 
 		/* 6.2 Literal Header Field Representation */
 		else if (id != NULL) {
-			DPRINTF("%s: index+name %zu, %s", __func__,
+			DPRINTF("%s: index+name %zu, %.*s", __func__,
 			    id->hpi_id,
-			    hdr->hdr_value);
+			    (int)hf.hpf_value_len, hf.hpf_value);
 
 			if (hpack_encode_int(hbuf, id->hpi_id,
 			    mask, flag) == -1)
-				goto fail;
+				return (-1);
+			hpack->htb_stats.hst_name_hits++;
 		} else {
-			DPRINTF("%s: literal %s: %s", __func__,
-			    hdr->hdr_name,
-			    hdr->hdr_value);
+			DPRINTF("%s: literal %.*s: %.*s", __func__,
+			    (int)hf.hpf_name_len, hf.hpf_name,
+			    (int)hf.hpf_value_len, hf.hpf_value);
 
 			if (hpack_encode_int(hbuf, 0, mask, flag) == -1)
-				goto fail;
+				return (-1);
 
 			/* name */
-			if (hpack_encode_str(hbuf, hdr->hdr_name) == -1)
-				goto fail;
+			if (hpack_encode_str(hbuf,
+			    hf.hpf_name, hf.hpf_name_len, 0, hpack) == -1)
+				return (-1);
+			hpack->htb_stats.hst_literals++;
 		}
 
 		/* value */
-		if (hpack_encode_str(hbuf, hdr->hdr_value) == -1)
-			goto fail;
+		if (hpack_encode_str(hbuf, hf.hpf_value, hf.hpf_value_len,
+		    hf.hpf_flags, hpack) == -1)
+			return (-1);
 
 		/* Optionally add to index */
-		if (hpack_table_add(hdr, hpack) == -1)
-			goto fail;
+		if (index == HPACK_INDEX &&
+		    hpack_table_add(&hf, hpack) == -1)
+			return (-1);
 	}
+	hpack->htb_stats.hst_bytes_out += hbuf->wpos - start;
 
-	return (hbuf_release(hbuf, encoded_len));
- fail:
-	hpack_table_free(ctx);
-	hbuf_free(hbuf);
-	return (NULL);
+	return (0);
 }
 
 static int
 hpack_encode_int(struct hbuf *buf, long i, unsigned char prefix,
     unsigned char type)
 {
-	unsigned char	b, m;
+	unsigned char	*p, m = ~prefix;
+	size_t		 len, n;
 
 	if (i < 0)
 		return (-1);
 
-	/* The first octet encodes up to prefix length bits */
-	m = ~prefix;
-	if (i <= m)
-		b = (i & m) | type;
-	else
-		b = m | type;
-	if (hbuf_writechar(buf, b) == -1)
-		return (-1);
-	i -= m;
-
-	/* Encode the remainder as a varint */
-	for (m = 0x80; i >= m; i /= m) {
-		b = i % m + m;
-		/* Set the continuation bit if there are steps left */
-		if (i >= m)
-			b |= m;
-		if (hbuf_writechar(buf, b) == -1)
+	/* Most integers fit into the prefix of the first octet */
+	if (i < m) {
+		if ((p = hbuf_reserve(buf, 1)) == NULL)
 			return (-1);
+		p[0] = (unsigned char)i | type;
+		return (0);
 	}
-	if (i > 0 &&
-	    hbuf_writechar(buf, (unsigned char)i) == -1)
+
+	/* Reserve all octets at once and encode the remainder as a varint */
+	len = hpack_encode_intlen(i, prefix);
+	if ((p = hbuf_reserve(buf, len)) == NULL)
 		return (-1);
+	p[0] = m | type;
+	for (i -= m, n = 1; n < len - 1; n++, i >>= 7)
+		p[n] = (unsigned char)(i & 0x7f) | 0x80;
+	p[n] = (unsigned char)i;
 
 	return (0);
 }
 
+static size_t
+hpack_encode_intlen(long i, unsigned char prefix)
+{
+	unsigned char	m = ~prefix;
+	size_t		len = 1;
+
+	/* The prefix and the remainder as a varint */
+	if (i >= m) {
+		for (i -= m, len++; i >= 0x80; i >>= 7)
+			len++;
+	}
+
+	return (len);
+}
+
+static size_t
+hpack_encode_strlen(const char *str, size_t slen, unsigned int flags)
+{
+	size_t	 len = slen;
+
+	/* The same choice of the Huffman code as in hpack_encode_str() */
+	if ((flags & HPACK_FIELD_HUFFMAN) == 0) {
+		len = hpack_huffman_encode_len((const unsigned char *)str,
+		    slen, slen);
+		if (len == 0 || len >= slen)
+			len = slen;
+	}
+
+	return (hpack_encode_intlen(len, HPACK_M_LITERAL) + len);
+}
+
 static int
-hpack_encode_str(struct hbuf *buf, char *str)
+hpack_encode_str(struct hbuf *buf, const char *str, size_t slen,
+    unsigned int flags, struct hpack_table *hpack)
 {
-	unsigned char	*data = NULL;
-	size_t		 len, slen;
-	int		 ret = -1;
+	unsigned char	*data;
+	size_t		 len;
+
+	/* Copy the Huffman code that was checked by hpack_encode_bound() */
+	if (flags & HPACK_FIELD_HUFFMAN) {
+		DPRINTF("%s: copied huffman code (size %zu)", __func__, slen);
+		if (hpack_encode_int(buf, slen, HPACK_M_LITERAL,
+		    HPACK_F_LITERAL_HUFFMAN) == -1 ||
+		    hbuf_writebuf(buf,
+		    (const unsigned char *)str, slen) == -1)
+			return (-1);
+		hpack->htb_stats.hst_huffman++;
+		return (0);
+	}
 
 	/*
-	 * We have to decide if the string should be encoded with huffman
-	 * encoding or as literal string.  There could be better heuristics
-	 * to do this...
+	 * Use the Huffman encoding if it is shorter than the literal
+	 * string.  The length is calculated without encoding the string
+	 * and the calculation stops as soon as the literal string wins.
 	 */
-	slen = strlen(str);
-	if ((data = hpack_huffman_encode(str, slen, &len)) == NULL)
-		goto done;
+	len = hpack_huffman_encode_len((const unsigned char *)str,
+	    slen, slen);
 	if (len > 0 && len < slen) {
 		DPRINTF("%s: encoded huffman code (size %ld, from %ld)",
 		    __func__, len, slen);
 		if (hpack_encode_int(buf, len, HPACK_M_LITERAL,
 		    HPACK_F_LITERAL_HUFFMAN) == -1)
-			goto done;
-		if (hbuf_writebuf(buf, data, len) == -1)
-			goto done;
+			return (-1);
+		if ((data = hbuf_reserve(buf, len)) == NULL)
+			return (-1);
+		hpack_huffman_encode_buf((const unsigned char *)str,
+		    slen, data);
+		hpack->htb_stats.hst_huffman++;
+		hpack->htb_stats.hst_huffman_saved += slen - len;
 	} else {
 		if (hpack_encode_int(buf, slen, HPACK_M_LITERAL,
 		    HPACK_F_LITERAL) == -1)
-			goto done;
-		if (hbuf_writebuf(buf, str, slen) == -1)
-			goto done;
+			return (-1);
+		if (hbuf_writebuf(buf,
+		    (const unsigned char *)str, slen) == -1)
+			return (-1);
+		hpack->htb_stats.hst_raw++;
 	}
 
-	ret = 0;
- done:
-	free(data);
-	return (ret);
+	return (0);
 }
 
-static int
-hpack_huffman_init(void)
+#ifndef HPACK_HUFFMAN_TREE
+static ssize_t
+hpack_huffman_decode_buf(const unsigned char *buf, size_t len,
+    unsigned char *out, unsigned char *classp)
 {
-	struct hpack_huffman		*hph;
-	struct hpack_huffman_node	*root, *cur, *node;
-	unsigned int			 i, j;
-
-	/* Create new Huffman tree */
-	if ((root = hpack_huffman_new()) == NULL)
-		return (-1);
+	const struct hpack_huffman_state	*hps;
+	unsigned char				*ptr = out;
+	unsigned int				 state = 0, j;
+	unsigned char				 flags = HPACK_HUFFMAN_F_ACCEPT;
+	unsigned char				 cls = 0;
+	size_t					 i;
 
-	for (i = 0; i < HPACK_HUFFMAN_SIZE; i++) {
-		hph = &huffman_table[i];
-		cur = root;
-
-		/* Create branch for each symbol */
-		for (j = hph->hph_length; j > 0; j--) {
-			if ((hph->hph_code >> (j - 1)) & 1) {
-				if (cur->hpn_one == NULL) {
-					if ((node =
-					    hpack_huffman_new()) == NULL)
-						goto fail;
-					cur->hpn_one = node;
-				}
-				cur = cur->hpn_one;
-			} else {
-				if (cur->hpn_zero == NULL) {
-					if ((node =
-					    hpack_huffman_new()) == NULL)
-						goto fail;
-					cur->hpn_zero = node;
-				}
-				cur = cur->hpn_zero;
+	for (i = 0; i < len; i++) {
+		/* Run the state machine for each nibble of the input */
+		for (j = 8; j > 0; j -= HPACK_HUFFMAN_BITS) {
+			hps = &huffman_fsm[state]
+			    [(buf[i] >> (j - HPACK_HUFFMAN_BITS)) &
+			    ((1 << HPACK_HUFFMAN_BITS) - 1)];
+			flags = hps->hps_flags;
+			if (flags & HPACK_HUFFMAN_F_FAIL) {
+				DPRINTF("%s: invalid code", __func__);
+				return (-1);
+			}
+			if (flags & HPACK_HUFFMAN_F_SYM) {
+				/* Collect the classes of the output */
+				cls |= char_class[hps->hps_sym];
+				*ptr++ = hps->hps_sym;
 			}
+			state = hps->hps_state;
 		}
+	}
 
-		/* The leaf node contains the (8-bit ASCII) symbol */
-		cur->hpn_sym = i;
+	/* The remaining bits must be a valid EOS padding */
+	if ((flags & HPACK_HUFFMAN_F_ACCEPT) == 0) {
+		DPRINTF("%s: invalid padding", __func__);
+		return (-1);
 	}
 
-	hpack_global.hpack_huffman = root;
-	return (0);
- fail:
-	hpack_huffman_free(root);
-	hpack_global.hpack_huffman = NULL;
-	return (-1);
+	*classp = cls;
+	return (ptr - out);
 }
 
-unsigned char *
-hpack_huffman_decode(unsigned char *buf, size_t len, size_t *decoded_len)
+static int
+hpack_huffman_check(const unsigned char *buf, size_t len,
+    unsigned char *classp)
 {
-	struct hpack_huffman_node	*node, *root;
-	unsigned int			 i, j, code;
-	struct hbuf			*hbuf = NULL;
+	const struct hpack_huffman_state	*hps;
+	unsigned int				 state = 0, j;
+	unsigned char				 flags = HPACK_HUFFMAN_F_ACCEPT;
+	unsigned char				 cls = 0;
+	size_t					 i;
 
-	if ((root = node = hpack_global.hpack_huffman) == NULL)
-		errx(1, "hpack not initialized");
+	/* Run the state machine like the decoder but only keep classes */
+	for (i = 0; i < len; i++) {
+		for (j = 8; j > 0; j -= HPACK_HUFFMAN_BITS) {
+			hps = &huffman_fsm[state]
+			    [(buf[i] >> (j - HPACK_HUFFMAN_BITS)) &
+			    ((1 << HPACK_HUFFMAN_BITS) - 1)];
+			flags = hps->hps_flags;
+			if (flags & HPACK_HUFFMAN_F_FAIL)
+				return (-1);
+			if (flags & HPACK_HUFFMAN_F_SYM)
+				cls |= char_class[hps->hps_sym];
+			state = hps->hps_state;
+		}
+	}
+	if ((flags & HPACK_HUFFMAN_F_ACCEPT) == 0)
+		return (-1);
 
-	if ((hbuf = hbuf_new(NULL, len)) == NULL)
-		return (NULL);
+	*classp = cls;
+	return (0);
+}
+#else
+static ssize_t
+hpack_huffman_decode_buf(const unsigned char *buf, size_t len,
+    unsigned char *out, unsigned char *classp)
+{
+	unsigned char			*ptr = out, cls = 0;
+	unsigned int			 j, bit, code, node = 0;
+	unsigned int			 bits = 0, pad = 1;
+	size_t				 i;
 
 	for (i = 0; i < len; i++) {
 		code = buf[i];
 
 		/* Walk the Huffman tree for each bit in the encoded input */
 		for (j = 8; j > 0; j--) {
-			if ((code >> (j - 1)) & 1)
-				node = node->hpn_one;
-			else
-				node = node->hpn_zero;
-			if (node->hpn_sym == -1)
+			bit = (code >> (j - 1)) & 1;
+			node = huffman_tree[node].hpn_child[bit];
+			bits++;
+			pad &= bit;
+			if (node < HPACK_HUFFMAN_LEAF)
 				continue;
+			if (node == HPACK_HUFFMAN_LEAF + 256) {
+				DPRINTF("%s: invalid code", __func__);
+				return (-1);
+			}
 
 			/* Leaf node of the next (8-bit ASCII) symbol */
-			if (hbuf_writechar(hbuf,
-			    (unsigned char)node->hpn_sym) == -1) {
-				DPRINTF("%s: failed to add '%c'", __func__,
-				    node->hpn_sym);
-				goto fail;
-			}
-			node = root;
+			*ptr = (unsigned char)(node - HPACK_HUFFMAN_LEAF);
+			cls |= char_class[*ptr++];
+			node = 0;
+			bits = 0;
+			pad = 1;
+		}
+	}
+
+	/* The remaining bits must be a valid EOS padding */
+	if (bits > 7 || !pad) {
+		DPRINTF("%s: invalid padding", __func__);
+		return (-1);
+	}
+
+	*classp = cls;
+	return (ptr - out);
+}
+
+static int
+hpack_huffman_check(const unsigned char *buf, size_t len,
+    unsigned char *classp)
+{
+	unsigned int			 j, bit, code, node = 0;
+	unsigned int			 bits = 0, pad = 1;
+	unsigned char			 cls = 0;
+	size_t				 i;
+
+	/* Walk the tree like the decoder but only keep the classes */
+	for (i = 0; i < len; i++) {
+		code = buf[i];
+		for (j = 8; j > 0; j--) {
+			bit = (code >> (j - 1)) & 1;
+			node = huffman_tree[node].hpn_child[bit];
+			bits++;
+			pad &= bit;
+			if (node < HPACK_HUFFMAN_LEAF)
+				continue;
+			if (node == HPACK_HUFFMAN_LEAF + 256)
+				return (-1);
+			cls |= char_class[node - HPACK_HUFFMAN_LEAF];
+			node = 0;
+			bits = 0;
+			pad = 1;
 		}
 	}
+	if (bits > 7 || !pad)
+		return (-1);
+
+	*classp = cls;
+	return (0);
+}
+#endif /* HPACK_HUFFMAN_TREE */
+
+unsigned char *
+hpack_huffman_decode(unsigned char *buf, size_t len, size_t *decoded_len)
+{
+	struct hbuf	*hbuf = NULL;
+	ssize_t		 n;
+	unsigned char	 cls;
+
+	if (len > SIZE_MAX / 8 ||
+	    (hbuf = hbuf_new(NULL, HPACK_HUFFMAN_DECODE_MAX(len))) == NULL)
+		goto fail;
+	if ((n = hpack_huffman_decode_buf(buf, len, hbuf->data, &cls)) == -1)
+		goto fail;
+	hbuf->wpos = (size_t)n;
 
 	return (hbuf_release(hbuf, decoded_len));
  fail:
@@ -883,107 +2745,187 @@ hpack_huffman_decode(unsigned char *buf, size_t len, size_t *decoded_len)
 char *
 hpack_huffman_decode_str(unsigned char *buf, size_t len)
 {
-	unsigned char	*data;
-	char		*str;
+	struct hbuf	*hbuf;
+	ssize_t		 n;
 	size_t		 data_len;
-
-	if ((data = hpack_huffman_decode(buf, len, &data_len)) == NULL)
-		return (NULL);
+	unsigned char	 cls;
 
 	/* Allocate with an extra NUL character */
-	if ((str = recallocarray(data, data_len, data_len + 1, 1)) == NULL) {
-		freezero(data, data_len);
+	if (len > SIZE_MAX / 8 || (hbuf = hbuf_new(NULL,
+	    HPACK_HUFFMAN_DECODE_MAX(len) + 1)) == NULL)
 		return (NULL);
-	}
 
-	/* Check if this is an actual string (no matter of the encoding) */
-	if (strlen(str) != data_len) {
-		freezero(str, data_len + 1);
-		str = NULL;
+	/* Check if this is an actual string while decoding it */
+	if ((n = hpack_huffman_decode_buf(buf, len,
+	    hbuf->data, &cls)) == -1 || (cls & HPACK_CHAR_NUL)) {
+		hbuf_free(hbuf);
+		return (NULL);
 	}
+	hbuf->data[n] = '\0';
+	hbuf->wpos = (size_t)n + 1;
 
-	return (str);
+	return ((char *)hbuf_release(hbuf, &data_len));
 }
 
 unsigned char *
 hpack_huffman_encode(unsigned char *data, size_t len, size_t *encoded_len)
 {
 	struct hbuf		*hbuf;
-	struct hpack_huffman	*hph;
-	unsigned int		 code, i, j;
-	unsigned char		 o, obits;
+	size_t			 size;
 
-	if ((hbuf = hbuf_new(NULL, len)) == NULL)
+	size = hpack_huffman_encode_len(data, len, SIZE_MAX);
+	if ((hbuf = hbuf_new(NULL, size)) == NULL) {
+		*encoded_len = 0;
 		return (NULL);
+	}
+	hpack_huffman_encode_buf(data, len, hbuf->data);
+	hbuf->wpos = size;
+
+	return (hbuf_release(hbuf, encoded_len));
+}
+
+static size_t
+hpack_huffman_encode_len(const unsigned char *data, size_t len, size_t max)
+{
+	size_t		 bits = 0, maxbits, i;
+
+	/* Stop early when the encoded length exceeds the maximum */
+	maxbits = max > SIZE_MAX / 8 ? SIZE_MAX - 7 : max * 8;
+
+	/* Sum the code lengths and round up to the padded octets */
+	for (i = 0; i + 4 <= len; i += 4) {
+		bits += huffman_table[data[i]].hph_length +
+		    huffman_table[data[i + 1]].hph_length +
+		    huffman_table[data[i + 2]].hph_length +
+		    huffman_table[data[i + 3]].hph_length;
+		if (bits > maxbits)
+			return ((bits + 7) / 8);
+	}
+	for (; i < len; i++)
+		bits += huffman_table[data[i]].hph_length;
+
+	return ((bits + 7) / 8);
+}
+
+static void
+hpack_huffman_encode_buf(const unsigned char *data, size_t len,
+    unsigned char *out)
+{
+	const struct hpack_huffman	*hph;
+	uint64_t			 acc = 0;
+	unsigned int			 bits = 0;
+	uint32_t			 word;
+	size_t				 i;
 
-	for (i = 0, o = 0, obits = 8; i < len; i++) {
-		/* Get Huffman code for each (8-bit ASCII) symbol */
+	for (i = 0; i < len; i++) {
+		/* Append the code of each (8-bit ASCII) symbol */
 		hph = &huffman_table[data[i]];
+		acc = (acc << hph->hph_length) | hph->hph_code;
+		bits += hph->hph_length;
 
-		for (code = hph->hph_code, j = hph->hph_length; j > 0;) {
-			if (j > obits) {
-				/* More bits to encode for this symbol */
-				j -= obits;
-				o |= (code >> j) & 0xff;
-				obits = 0;
-			} else {
-				/*
-				 * Remaining bits to encode for this input
-				 * symbol.  The current output octet will
-				 * include bits from the next symbol or padding.
-				 */
-				obits -= j;
-				o |= (code << obits) & 0xff;
-				j = 0;
-			}
-			if (obits == 0) {
-				if (hbuf_writechar(hbuf, o) == -1) {
-					DPRINTF("%s: failed to add '%c'",
-					    __func__, o);
-					goto fail;
-				}
-				o = 0;
-				obits = 8;
-			}
+		/*
+		 * Flush a 32-bit word, the accumulator never holds more
+		 * than 31 pending bits plus the longest code of 30 bits.
+		 */
+		if (bits >= 32) {
+			bits -= 32;
+			word = (uint32_t)(acc >> bits);
+			*out++ = word >> 24;
+			*out++ = word >> 16;
+			*out++ = word >> 8;
+			*out++ = word;
 		}
 	}
 
-	if (len && obits > 0 && obits < 8) {
-		/* Pad last octet with ones (EOS) */
-		o |= (1 << obits) - 1;
-		if (hbuf_writechar(hbuf, o) == -1) {
-			DPRINTF("%s: failed to add '%c'", __func__, o);
-			goto fail;
-		}
+	/* Pad the last octet with ones (EOS) */
+	if (bits % 8) {
+		acc = (acc << (8 - bits % 8)) | ((1 << (8 - bits % 8)) - 1);
+		bits += 8 - bits % 8;
+	}
+	while (bits > 0) {
+		bits -= 8;
+		*out++ = (unsigned char)(acc >> bits);
 	}
+}
 
-	return (hbuf_release(hbuf, encoded_len));
- fail:
-	*encoded_len = 0;
-	hbuf_free(hbuf);
-	return (NULL);
+static void *
+hpack_arena_alloc(const struct hpack_allocator *alloc,
+    struct hpack_arena **arenap, size_t len)
+{
+	struct hpack_arena	*ha = *arenap;
+	size_t			 size, used = 0;
+	void			*ptr;
+
+	/* Align the allocations for the headers in the arena */
+	if (ha != NULL)
+		used = (ha->ha_used + HPACK_ARENA_ALIGN - 1) &
+		    ~(HPACK_ARENA_ALIGN - 1);
+
+	if (ha == NULL || used > ha->ha_size || ha->ha_size - used < len) {
+		if (len > SIZE_MAX - sizeof(*ha))
+			return (NULL);
+		size = MAX(HPACK_ARENA_SIZE, len);
+		if ((ha = hpack_malloc(alloc, sizeof(*ha) + size)) == NULL)
+			return (NULL);
+		ha->ha_alloc = alloc;
+		ha->ha_size = size;
+		ha->ha_next = *arenap;
+		*arenap = ha;
+		used = 0;
+	}
+
+	ptr = ha->ha_data + used;
+	ha->ha_used = used + len;
+
+	return (ptr);
 }
 
-static struct hpack_huffman_node *
-hpack_huffman_new(void)
+static void
+hpack_arena_trim(struct hpack_arena **arenap, void *ptr, size_t len)
 {
-	struct hpack_huffman_node	*node;
+	struct hpack_arena	*ha = *arenap;
 
-	if ((node = calloc(1, sizeof(*node))) == NULL)
-		return (NULL);
-	node->hpn_sym = -1;
+	/* Return the unused tail of the last allocation */
+	ha->ha_used = ((unsigned char *)ptr - ha->ha_data) + len;
+}
+
+static int
+hpack_arena_copy(const struct hpack_allocator *alloc,
+    struct hpack_arena **arenap, const char **strp, size_t len)
+{
+	char	*ptr;
 
-	return (node);
+	if ((ptr = hpack_arena_alloc(alloc, arenap, len)) == NULL)
+		return (-1);
+	memcpy(ptr, *strp, len);
+	*strp = ptr;
+
+	return (0);
 }
 
 static void
-hpack_huffman_free(struct hpack_huffman_node *root)
+hpack_arena_reset(struct hpack_arena **arenap)
 {
-	if (root == NULL)
+	struct hpack_arena	*ha = *arenap;
+
+	if (ha == NULL)
 		return;
-	hpack_huffman_free(root->hpn_zero);
-	hpack_huffman_free(root->hpn_one);
-	free(root);
+
+	/* Keep the newest chunk for the next allocations */
+	hpack_arena_free(ha->ha_next);
+	ha->ha_next = NULL;
+	ha->ha_used = 0;
+}
+
+static void
+hpack_arena_free(struct hpack_arena *ha)
+{
+	struct hpack_arena	*next;
+
+	for (; ha != NULL; ha = next) {
+		next = ha->ha_next;
+		hpack_free(ha->ha_alloc, ha);
+	}
 }
 
 static struct hbuf *
@@ -1007,6 +2949,15 @@ hbuf_new(unsigned char *data, size_t len)
 	return (buf);
 }
 
+static void
+hbuf_init(struct hbuf *buf, unsigned char *data, size_t len)
+{
+	/* Read from the caller's data without copying it */
+	memset(buf, 0, sizeof(*buf));
+	buf->data = data;
+	buf->size = buf->wpos = len;
+}
+
 static void
 hbuf_free(struct hbuf *buf)
 {
@@ -1022,6 +2973,10 @@ hbuf_realloc(struct hbuf *buf, size_t len)
 	unsigned char	*ptr;
 	size_t		 newsize;
 
+	/* Buffers that are provided by the caller cannot grow */
+	if (buf->wbsz == 0)
+		return (-1);
+
 	/* Allocate a multiple of the initial write buffer size */
 	newsize = (buf->size + len + (buf->wbsz - 1)) & ~(buf->wbsz - 1);
 
@@ -1036,13 +2991,7 @@ hbuf_realloc(struct hbuf *buf, size_t len)
 }
 
 static int
-hbuf_writechar(struct hbuf *buf, unsigned char c)
-{
-	return (hbuf_writebuf(buf, &c, 1));
-}
-
-static int
-hbuf_writebuf(struct hbuf *buf, unsigned char *data, size_t len)
+hbuf_writebuf(struct hbuf *buf, const unsigned char *data, size_t len)
 {
 	if ((buf->wpos + len > buf->size) &&
 	    hbuf_realloc(buf, len) == -1)
@@ -1054,6 +3003,22 @@ hbuf_writebuf(struct hbuf *buf, unsigned char *data, size_t len)
 	return (0);
 }
 
+static unsigned char *
+hbuf_reserve(struct hbuf *buf, size_t len)
+{
+	unsigned char	*ptr;
+
+	/* Return space for len bytes that are written by the caller */
+	if ((buf->wpos + len > buf->size) &&
+	    hbuf_realloc(buf, len) == -1)
+		return (NULL);
+
+	ptr = buf->data + buf->wpos;
+	buf->wpos += len;
+
+	return (ptr);
+}
+
 static unsigned char *
 hbuf_release(struct hbuf *buf, size_t *len)
 {
@@ -1082,8 +3047,10 @@ hbuf_release(struct hbuf *buf, size_t *len)
 static int
 hbuf_readchar(struct hbuf *buf, unsigned char *c)
 {
-	if (buf->rpos + 1 > buf->size)
+	if (buf->rpos + 1 > buf->wpos) {
+		buf->need = buf->rpos + 1;
 		return (-1);
+	}
 	*c = *(buf->data + buf->rpos);
 	return (0);
 }
@@ -1091,8 +3058,10 @@ hbuf_readchar(struct hbuf *buf, unsigned char *c)
 static int
 hbuf_readbuf(struct hbuf *buf, unsigned char **ptr, size_t len)
 {
-	if (buf->rpos + len > buf->size)
+	if (buf->rpos + len > buf->wpos) {
+		buf->need = buf->rpos + len;
 		return (-1);
+	}
 	*ptr = buf->data + buf->rpos;
 	return (0);
 }
@@ -1100,8 +3069,10 @@ hbuf_readbuf(struct hbuf *buf, unsigned char **ptr, size_t len)
 static int
 hbuf_advance(struct hbuf *buf, size_t len)
 {
-	if (buf->rpos + len > buf->size)
+	if (buf->rpos + len > buf->wpos) {
+		buf->need = buf->rpos + len;
 		return (-1);
+	}
 	buf->rpos += len;
 	return (0);
 }
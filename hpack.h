@@ -22,6 +22,10 @@
 #define HPACK_H
 
 struct hpack_table;
+struct hpack_arena;
+struct hpack_reflist;
+struct hpack_decoder;
+struct hpack_allocator;
 
 enum hpack_header_index {
 	HPACK_NO_INDEX = 0,
@@ -29,33 +33,243 @@ enum hpack_header_index {
 	HPACK_INDEX,
 };
 
+/* Admission policy of the encoder for headers with HPACK_INDEX */
+enum hpack_policy {
+	HPACK_POLICY_INDEX = 0,
+	HPACK_POLICY_FREQUENCY,
+};
+
+/* Names of the static table, the value is the index of the first entry */
+enum hpack_token {
+	HPACK_TOKEN_UNKNOWN = 0,
+	HPACK_TOKEN_AUTHORITY = 1,
+	HPACK_TOKEN_METHOD = 2,
+	HPACK_TOKEN_PATH = 4,
+	HPACK_TOKEN_SCHEME = 6,
+	HPACK_TOKEN_STATUS = 8,
+	HPACK_TOKEN_ACCEPT_CHARSET = 15,
+	HPACK_TOKEN_ACCEPT_ENCODING = 16,
+	HPACK_TOKEN_ACCEPT_LANGUAGE = 17,
+	HPACK_TOKEN_ACCEPT_RANGES = 18,
+	HPACK_TOKEN_ACCEPT = 19,
+	HPACK_TOKEN_ACCESS_CONTROL_ALLOW_ORIGIN = 20,
+	HPACK_TOKEN_AGE = 21,
+	HPACK_TOKEN_ALLOW = 22,
+	HPACK_TOKEN_AUTHORIZATION = 23,
+	HPACK_TOKEN_CACHE_CONTROL = 24,
+	HPACK_TOKEN_CONTENT_DISPOSITION = 25,
+	HPACK_TOKEN_CONTENT_ENCODING = 26,
+	HPACK_TOKEN_CONTENT_LANGUAGE = 27,
+	HPACK_TOKEN_CONTENT_LENGTH = 28,
+	HPACK_TOKEN_CONTENT_LOCATION = 29,
+	HPACK_TOKEN_CONTENT_RANGE = 30,
+	HPACK_TOKEN_CONTENT_TYPE = 31,
+	HPACK_TOKEN_COOKIE = 32,
+	HPACK_TOKEN_DATE = 33,
+	HPACK_TOKEN_ETAG = 34,
+	HPACK_TOKEN_EXPECT = 35,
+	HPACK_TOKEN_EXPIRES = 36,
+	HPACK_TOKEN_FROM = 37,
+	HPACK_TOKEN_HOST = 38,
+	HPACK_TOKEN_IF_MATCH = 39,
+	HPACK_TOKEN_IF_MODIFIED_SINCE = 40,
+	HPACK_TOKEN_IF_NONE_MATCH = 41,
+	HPACK_TOKEN_IF_RANGE = 42,
+	HPACK_TOKEN_IF_UNMODIFIED_SINCE = 43,
+	HPACK_TOKEN_LAST_MODIFIED = 44,
+	HPACK_TOKEN_LINK = 45,
+	HPACK_TOKEN_LOCATION = 46,
+	HPACK_TOKEN_MAX_FORWARDS = 47,
+	HPACK_TOKEN_PROXY_AUTHENTICATE = 48,
+	HPACK_TOKEN_PROXY_AUTHORIZATION = 49,
+	HPACK_TOKEN_RANGE = 50,
+	HPACK_TOKEN_REFERER = 51,
+	HPACK_TOKEN_REFRESH = 52,
+	HPACK_TOKEN_RETRY_AFTER = 53,
+	HPACK_TOKEN_SERVER = 54,
+	HPACK_TOKEN_SET_COOKIE = 55,
+	HPACK_TOKEN_STRICT_TRANSPORT_SECURITY = 56,
+	HPACK_TOKEN_TRANSFER_ENCODING = 57,
+	HPACK_TOKEN_USER_AGENT = 58,
+	HPACK_TOKEN_VARY = 59,
+	HPACK_TOKEN_VIA = 60,
+	HPACK_TOKEN_WWW_AUTHENTICATE = 61,
+};
+
 struct hpack_header {
 	char				*hdr_name;
 	char				*hdr_value;
+	size_t				 hdr_name_len;
+	size_t				 hdr_value_len;
 	enum hpack_header_index		 hdr_index;
+	enum hpack_token		 hdr_token;
 	TAILQ_ENTRY(hpack_header)	 hdr_entry;
 };
 TAILQ_HEAD(hpack_headerblock, hpack_header);
 
+/* Decoded header block that owns its headers and their memory */
+struct hpack_block {
+	struct hpack_headerblock	 hbk_headers;
+	struct hpack_arena		*hbk_arena;
+	const struct hpack_allocator	*hbk_alloc;
+};
+
+/* Header field that references the decoded data (not NUL-terminated) */
+struct hpack_field {
+	const char			*hpf_name;
+	size_t				 hpf_name_len;
+	const char			*hpf_value;
+	size_t				 hpf_value_len;
+	enum hpack_header_index		 hpf_index;
+	enum hpack_token		 hpf_token;
+	unsigned int			 hpf_flags;
+};
+#define HPACK_FIELD_HUFFMAN	0x01	/* Value is still Huffman-encoded */
+
+struct hpack_fieldblock {
+	struct hpack_field		*hfb_fields;
+	size_t				 hfb_nfields;
+	size_t				 hfb_size;
+	struct hpack_arena		*hfb_arena;
+	struct hpack_reflist		*hfb_refs;
+	const struct hpack_allocator	*hfb_alloc;
+};
+
+/* Request methods of the :method pseudo-header */
+enum hpack_method {
+	HPACK_METHOD_NONE = 0,
+	HPACK_METHOD_GET,
+	HPACK_METHOD_HEAD,
+	HPACK_METHOD_POST,
+	HPACK_METHOD_PUT,
+	HPACK_METHOD_DELETE,
+	HPACK_METHOD_CONNECT,
+	HPACK_METHOD_OPTIONS,
+	HPACK_METHOD_TRACE,
+	HPACK_METHOD_PATCH,
+	HPACK_METHOD_OTHER,
+};
+
+/* Decoded string that is owned by a header block (NUL-terminated) */
+struct hpack_view {
+	const char			*hpv_str;
+	size_t				 hpv_len;
+};
+
+/* Pseudo-header fields of a request or response */
+struct hpack_pseudo {
+	struct hpack_view		 hpp_method;	/* :method */
+	struct hpack_view		 hpp_scheme;	/* :scheme */
+	struct hpack_view		 hpp_authority;	/* :authority */
+	struct hpack_view		 hpp_path;	/* :path */
+	struct hpack_view		 hpp_status;	/* :status */
+	enum hpack_method		 hpp_method_id;
+	int				 hpp_status_code;
+};
+
+/* Counters of the encoder and decoder that use a table */
+struct hpack_stats {
+	size_t	 hst_static_hits;	/* indexed from the static table */
+	size_t	 hst_dynamic_hits;	/* indexed from the dynamic table */
+	size_t	 hst_name_hits;		/* literal with indexed name */
+	size_t	 hst_literals;		/* literal with literal name */
+	size_t	 hst_huffman;		/* Huffman-encoded strings */
+	size_t	 hst_raw;		/* raw strings */
+	size_t	 hst_huffman_saved;	/* bytes saved by Huffman */
+	size_t	 hst_inserts;		/* entries added to the table */
+	size_t	 hst_evictions;		/* entries evicted */
+	size_t	 hst_size_updates;	/* table size updates */
+	size_t	 hst_bytes_in;		/* decoded header block bytes */
+	size_t	 hst_bytes_out;		/* encoded header block bytes */
+	size_t	 hst_peak_size;		/* peak size of the table */
+};
+
+/* Validation errors of decoded names and values */
+enum hpack_errcode {
+	HPACK_ERR_NONE = 0,
+	HPACK_ERR_NAME_UPPERCASE,	/* upper case character in a name */
+	HPACK_ERR_NAME_CHAR,		/* invalid character in a name */
+	HPACK_ERR_VALUE_CHAR,		/* NUL, CR, or LF in a value */
+};
+
+struct hpack_error {
+	enum hpack_errcode	 hpe_code;	/* reason or HPACK_ERR_NONE */
+	size_t			 hpe_offset;	/* offset of the string */
+	size_t			 hpe_pos;	/* position in the string */
+	unsigned char		 hpe_char;	/* invalid character */
+};
+
+/* Memory allocator hooks, the default is malloc(3) and free(3) */
+struct hpack_allocator {
+	void	*(*hal_malloc)(size_t, void *);
+	void	*(*hal_realloc)(void *, size_t, void *);
+	void	 (*hal_free)(void *, void *);
+	void	*hal_arg;
+	int	 hal_flags;
+#define HPACK_ALLOC_ARENA	0x01	/* allocate decoded headers in an arena */
+};
+
 int	 hpack_init(void);
+int	 hpack_allocator_set(const struct hpack_allocator *);
 
 struct hpack_table
 	*hpack_table_new(size_t);
+struct hpack_table
+	*hpack_table_new_allocator(size_t, const struct hpack_allocator *);
 void	 hpack_table_free(struct hpack_table *);
 size_t	 hpack_table_size(struct hpack_table *);
 int	 hpack_table_setsize(long, struct hpack_table *);
+int	 hpack_table_setpolicy(enum hpack_policy, struct hpack_table *);
+int	 hpack_table_setvalidate(int, struct hpack_table *);
+void	 hpack_table_stats(struct hpack_table *, struct hpack_stats *);
+void	 hpack_table_error(struct hpack_table *, struct hpack_error *);
+void	 hpack_stats_add(struct hpack_stats *, const struct hpack_stats *);
 
 struct hpack_headerblock
 	*hpack_decode(unsigned char *, size_t, struct hpack_table *);
+struct hpack_block
+	*hpack_decode_block(unsigned char *, size_t, struct hpack_table *);
+struct hpack_block
+	*hpack_decode_pseudo(unsigned char *, size_t, struct hpack_pseudo *,
+	    struct hpack_table *);
+void	 hpack_block_free(struct hpack_block *);
+struct hpack_fieldblock
+	*hpack_decode_fields(unsigned char *, size_t, struct hpack_table *);
+struct hpack_fieldblock
+	*hpack_decode_fields_lazy(unsigned char *, size_t,
+	    struct hpack_table *);
+int	 hpack_field_decode(struct hpack_fieldblock *, struct hpack_field *);
+void	 hpack_fieldblock_free(struct hpack_fieldblock *);
+int	 hpack_decode_cb(unsigned char *, size_t, struct hpack_table *,
+	    int (*)(const struct hpack_field *, void *), void *);
+
+struct hpack_decoder
+	*hpack_decoder_new(struct hpack_table *);
+int	 hpack_decoder_feed(struct hpack_decoder *, unsigned char *, size_t,
+	    struct hpack_headerblock *);
+int	 hpack_decoder_finish(struct hpack_decoder *);
+int	 hpack_decoder_setmax(size_t, struct hpack_decoder *);
+void	 hpack_decoder_free(struct hpack_decoder *);
 unsigned char
 	*hpack_encode(struct hpack_headerblock *, size_t *,
 	    struct hpack_table *);
+int	 hpack_encode_buf(struct hpack_headerblock *, unsigned char *,
+	    size_t, size_t *, struct hpack_table *);
+unsigned char
+	*hpack_encode_fields(const struct hpack_field *, size_t, size_t *,
+	    struct hpack_table *);
+int	 hpack_encode_fields_buf(const struct hpack_field *, size_t,
+	    unsigned char *, size_t, size_t *, struct hpack_table *);
 
 struct hpack_header
 	*hpack_header_new(void);
 struct hpack_header
 	*hpack_header_add(struct hpack_headerblock *,
 	    const char *, const char *, enum hpack_header_index);
+struct hpack_header
+	*hpack_header_add_len(struct hpack_headerblock *,
+	    const char *, size_t, const char *, size_t,
+	    enum hpack_header_index);
 void	 hpack_header_free(struct hpack_header *);
 struct hpack_headerblock
 	*hpack_headerblock_new(void);
@@ -77,30 +291,186 @@ unsigned char
 
 /* from sys/param.h */
 #define MAX(a,b)		(((a)>(b))?(a):(b))
+#define MIN(a,b)		(((a)<(b))?(a):(b))
 
 #define HPACK_HUFFMAN_BUFSZ	256
 #define HPACK_MAX_TABLE_SIZE	4096
+#define HPACK_FIELDS_SIZE	16	/* initial fields of a field block */
+#define HPACK_ARENA_SIZE	4096	/* minimum size of an arena chunk */
+#define HPACK_ARENA_ALIGN	sizeof(void *)
+#define HPACK_INT_MAX		0x7fffffffL	/* largest decoded integer */
+#define HPACK_INT_OCTETS	5	/* continuation octets of the above */
+#define HPACK_DECODER_MAX	65536	/* largest buffered field */
+
+/* The length of a header string is optional if it is NUL-terminated */
+#define HPACK_HDR_LEN(_str, _len)					\
+	((_len) != 0 || (_str) == NULL ? (_len) : strlen(_str))
+
+/* Case-insensitive comparison of strings with lengths */
+#define HPACK_STREQ(_a, _alen, _b, _blen)				\
+	((_alen) == (_blen) && strncasecmp((_a), (_b), (_alen)) == 0)
+
+/* Use the allocator hooks or the default functions */
+#define HPACK_ALLOC_HOOKS(_a)	((_a) != NULL && (_a)->hal_malloc != NULL)
 
+/* The shortest code has 5 bits */
+#define HPACK_HUFFMAN_DECODE_MAX(_len)	((_len) * 8 / 5 + 1)
+
+/*
+ * Internal node of the Huffman decoding tree, generated by hpackgen.
+ * Each child is either the index of the next internal node or
+ * HPACK_HUFFMAN_LEAF plus the decoded symbol.
+ */
 struct hpack_huffman_node {
-	struct hpack_huffman_node	*hpn_zero;
-	struct hpack_huffman_node	*hpn_one;
-	int				 hpn_sym;
+	unsigned short			 hpn_child[2];
 };
+#define HPACK_HUFFMAN_LEAF	256
 
-struct hpack {
-	struct hpack_huffman_node	*hpack_huffman;
+/*
+ * The table-driven Huffman decoder is a state machine that consumes
+ * HPACK_HUFFMAN_BITS of input in each step.  Each state corresponds
+ * to an internal node of the Huffman tree, a complete binary tree
+ * with 257 leaves and 256 internal nodes.  As the shortest code has
+ * 5 bits, each 4-bit step emits at most one symbol.  The state
+ * machine is generated by hpackgen and compiled into the library.
+ */
+#define HPACK_HUFFMAN_BITS	4
+#define HPACK_HUFFMAN_STATES	256
+
+#define HPACK_HUFFMAN_F_SYM	0x01	/* emit the symbol */
+#define HPACK_HUFFMAN_F_ACCEPT	0x02	/* valid end of the input */
+#define HPACK_HUFFMAN_F_FAIL	0x04	/* invalid code (EOS) */
+
+struct hpack_huffman_state {
+	unsigned char			 hps_state;	/* next state */
+	unsigned char			 hps_flags;	/* flags */
+	unsigned char			 hps_sym;	/* decoded symbol */
+};
+
+/*
+ * Character classes of decoded strings, generated by hpackgen.
+ * NUL is always rejected, the other classes only with validation.
+ */
+#define HPACK_CHAR_NUL		0x01	/* NUL */
+#define HPACK_CHAR_VALUE	0x02	/* NUL, CR, LF */
+#define HPACK_CHAR_NAME		0x04	/* controls, SP, DEL, non-ASCII */
+#define HPACK_CHAR_UPPER	0x08	/* upper case letters */
+
+/*
+ * Reference-counted storage of the name and value of a dynamic table
+ * entry.  Field blocks borrow the strings of indexed fields instead of
+ * copying them, the storage is freed with the last field block or when
+ * the entry is evicted.
+ */
+struct hpack_ref {
+	const struct hpack_allocator	*hr_alloc;
+	atomic_uint			 hr_refs;
+	char				 hr_data[];
+};
+
+/* References that are held by a field block, allocated in its arena */
+struct hpack_reflist {
+	struct hpack_reflist		*hrl_next;
+	struct hpack_ref		*hrl_ref;
+};
+
+/* Entry in the dynamic table */
+struct hpack_entry {
+	char				*hte_name;
+	char				*hte_value;
+	size_t				 hte_name_len;
+	size_t				 hte_value_len;
+	struct hpack_ref		*hte_ref;
+	enum hpack_token		 hte_token;
+	long				 hte_size;
+
+	/* Hash chains of the (name) and (name, value) indexes */
+	unsigned int			 hte_namehash;
+	unsigned int			 hte_pairhash;
+	long				 hte_namenext;
+	long				 hte_pairnext;
+};
+
+#define HPACK_DYNAMIC_SLOTS	16	/* initial slots of the ring buffer */
+
+/*
+ * Count-min sketch of the (name, value) pairs that the encoder has
+ * seen.  Each row is indexed by another byte of the pair hash and
+ * the saturating counters are halved after HPACK_SKETCH_SAMPLES to
+ * forget the old history (TinyLFU).
+ */
+#define HPACK_SKETCH_DEPTH	4
+#define HPACK_SKETCH_WIDTH	256
+#define HPACK_SKETCH_MAX	15
+#define HPACK_SKETCH_SAMPLES	(HPACK_SKETCH_WIDTH * 10)
+
+struct hpack_sketch {
+	unsigned char			 hsk_count[HPACK_SKETCH_DEPTH]
+					    [HPACK_SKETCH_WIDTH];
+	unsigned int			 hsk_samples;
 };
 
 struct hpack_table {
-	struct hpack_headerblock	*htb_dynamic;
+	/*
+	 * The dynamic table is a ring buffer of entries.  New entries
+	 * are inserted at the head, the oldest entries are evicted from
+	 * the tail, and the number of slots is always a power of 2.
+	 */
+	struct hpack_entry		*htb_dynamic;
+	long				 htb_dynamic_slots;
+	long				 htb_dynamic_head;
 	long				 htb_dynamic_size;
 	long				 htb_dynamic_entries;
 
+	/*
+	 * Hash buckets of the encoder index, one per slot, with the
+	 * slot of the newest matching entry or -1 if it is empty.
+	 */
+	long				*htb_namebuckets;
+	long				*htb_pairbuckets;
+
 	long				 htb_table_size;
 	long				 htb_max_table_size;
 
-	struct hpack_headerblock	*htb_headers;
-	struct hpack_header		*htb_next;
+	const struct hpack_allocator	*htb_alloc;
+
+	/* Admission policy of the encoder, NULL to index all headers */
+	struct hpack_sketch		*htb_sketch;
+
+	/* Validation of decoded strings and the last error */
+	int				 htb_validate;
+	struct hpack_error		 htb_error;
+
+	struct hpack_stats		 htb_stats;
+};
+
+/*
+ * Resumable decoder for header blocks that are split into fragments.
+ * Only the bytes of a trailing incomplete field are buffered and the
+ * field is decoded again when the missing bytes have arrived.
+ */
+struct hpack_decoder {
+	struct hpack_table		*hdc_table;
+	struct hpack_table		*hdc_ctx;
+	struct hpack_arena		*hdc_arena;
+	const struct hpack_allocator	*hdc_alloc;
+	unsigned char			*hdc_buf;
+	size_t				 hdc_size;
+	size_t				 hdc_len;
+	size_t				 hdc_need;
+	size_t				 hdc_max;
+};
+
+/*
+ * Chunks of scratch memory for decoded strings that are released
+ * together with the field block.
+ */
+struct hpack_arena {
+	struct hpack_arena		*ha_next;
+	const struct hpack_allocator	*ha_alloc;
+	size_t				 ha_size;
+	size_t				 ha_used;
+	unsigned char			 ha_data[];
 };
 
 /* Simple internal buffer API */
@@ -110,6 +480,7 @@ struct hbuf {
 	size_t			 rpos;		/* read position */
 	size_t			 wpos;		/* write position */
 	size_t			 wbsz;		/* realloc buf size */
+	size_t			 need;		/* size needed by a short read */
 };
 
 /* Masks, flags, and prefixes of the field types */
@@ -134,70 +505,95 @@ struct hpack_index {
 	long			 hpi_id;	/* Index */
 	const char		*hpi_name;	/* Header Name */
 	const char		*hpi_value;	/* Value */
+	size_t			 hpi_name_len;
+	size_t			 hpi_value_len;
+	struct hpack_ref	*hpi_ref;	/* Shared strings */
+	enum hpack_token	 hpi_token;	/* Token of dynamic entries */
 };
+/*
+ * Perfect hash of the static table names, generated by hpackgen.
+ * The hash is calculated from the length and the first and last
+ * (lowercase) character of the name.  Each slot points to the first
+ * entry with the name, followed by the other entries with the same
+ * name as value candidates.
+ */
+struct hpack_static_hash {
+	unsigned char		 hsh_id;	/* Index of the first entry */
+	unsigned char		 hsh_count;	/* Number of entries */
+	unsigned char		 hsh_len;	/* Length of the name */
+};
+#define HPACK_STATIC_HASH_BITS	7
+#define HPACK_LOWER(_c)							\
+	((_c) >= 'A' && (_c) <= 'Z' ? (_c) + ('a' - 'A') : (_c))
+#define HPACK_STATIC_HASH(_mul, _len, _first, _last)			\
+	(((((uint32_t)(_len) & 0xff) << 16 |				\
+	    HPACK_LOWER((unsigned char)(_first)) << 8 |			\
+	    HPACK_LOWER((unsigned char)(_last))) * (uint32_t)(_mul)) >>	\
+	    (32 - HPACK_STATIC_HASH_BITS))
+
 #define HPACK_STATIC_SIZE (sizeof(static_table) / sizeof(static_table[0]))
 static struct hpack_index static_table[] = {
-	{ 1,	":authority",			NULL },			\
-	{ 2,	":method",			"GET" },		\
-	{ 3,	":method",			"POST" },		\
-	{ 4,	":path",			"/" },			\
-	{ 5,	":path",			"/index.html"},		\
-	{ 6,	":scheme",			"http" },		\
-	{ 7,	":scheme",			"https" },		\
-	{ 8,	":status",			"200" },		\
-	{ 9,	":status",			"204" },		\
-	{ 10,	":status",			"206" },		\
-	{ 11,	":status",			"304" },		\
-	{ 12,	":status",			"400" },		\
-	{ 13,	":status",			"404" },		\
-	{ 14,	":status",			"500" },		\
-	{ 15,	"accept-charset",		NULL },			\
-	{ 16,	"accept-encoding",		"gzip, deflate" },	\
-	{ 17,	"accept-language",		NULL },			\
-	{ 18,	"accept-ranges",		NULL },			\
-	{ 19,	"accept",			NULL },			\
-	{ 20,	"access-control-allow-origin",	NULL },			\
-	{ 21,	"age",				NULL },			\
-	{ 22,	"allow",			NULL },			\
-	{ 23,	"authorization",		NULL },			\
-	{ 24,	"cache-control",		NULL },			\
-	{ 25,	"content-disposition",		NULL },			\
-	{ 26,	"content-encoding",		NULL },			\
-	{ 27,	"content-language",		NULL },			\
-	{ 28,	"content-length",		NULL },			\
-	{ 29,	"content-location",		NULL },			\
-	{ 30,	"content-range",		NULL },			\
-	{ 31,	"content-type",			NULL },			\
-	{ 32,	"cookie",			NULL },			\
-	{ 33,	"date",				NULL },			\
-	{ 34,	"etag",				NULL },			\
-	{ 35,	"expect",			NULL },			\
-	{ 36,	"expires",			NULL },			\
-	{ 37,	"from",				NULL },			\
-	{ 38,	"host",				NULL },			\
-	{ 39,	"if-match",			NULL },			\
-	{ 40,	"if-modified-since",		NULL },			\
-	{ 41,	"if-none-match",		NULL },			\
-	{ 42,	"if-range",			NULL },			\
-	{ 43,	"if-unmodified-since",		NULL },			\
-	{ 44,	"last-modified",		NULL },			\
-	{ 45,	"link",				NULL },			\
-	{ 46,	"location",			NULL },			\
-	{ 47,	"max-forwards",			NULL },			\
-	{ 48,	"proxy-authenticate",		NULL },			\
-	{ 49,	"proxy-authorization",		NULL },			\
-	{ 50,	"range",			NULL },			\
-	{ 51,	"referer",			NULL },			\
-	{ 52,	"refresh",			NULL },			\
-	{ 53,	"retry-after",			NULL },			\
-	{ 54,	"server",			NULL },			\
-	{ 55,	"set-cookie",			NULL },			\
-	{ 56,	"strict-transport-security",	NULL },			\
-	{ 57,	"transfer-encoding",		NULL },			\
-	{ 58,	"user-agent",			NULL },			\
-	{ 59,	"vary",				NULL },			\
-	{ 60,	"via",				NULL },			\
-	{ 61,	"www-authenticate",		NULL },			\
+	{ 1,	":authority",		NULL,		10, 0 },	\
+	{ 2,	":method",		"GET",		7, 3 },		\
+	{ 3,	":method",		"POST",		7, 4 },		\
+	{ 4,	":path",		"/",		5, 1 },		\
+	{ 5,	":path",		"/index.html",	5, 11 },	\
+	{ 6,	":scheme",		"http",		7, 4 },		\
+	{ 7,	":scheme",		"https",	7, 5 },		\
+	{ 8,	":status",		"200",		7, 3 },		\
+	{ 9,	":status",		"204",		7, 3 },		\
+	{ 10,	":status",		"206",		7, 3 },		\
+	{ 11,	":status",		"304",		7, 3 },		\
+	{ 12,	":status",		"400",		7, 3 },		\
+	{ 13,	":status",		"404",		7, 3 },		\
+	{ 14,	":status",		"500",		7, 3 },		\
+	{ 15,	"accept-charset",	NULL,		14, 0 },	\
+	{ 16,	"accept-encoding",	"gzip, deflate", 15, 13 },	\
+	{ 17,	"accept-language",	NULL,		15, 0 },	\
+	{ 18,	"accept-ranges",	NULL,		13, 0 },	\
+	{ 19,	"accept",		NULL,		6, 0 },		\
+	{ 20,	"access-control-allow-origin", NULL,	27, 0 },	\
+	{ 21,	"age",			NULL,		3, 0 },		\
+	{ 22,	"allow",		NULL,		5, 0 },		\
+	{ 23,	"authorization",	NULL,		13, 0 },	\
+	{ 24,	"cache-control",	NULL,		13, 0 },	\
+	{ 25,	"content-disposition",	NULL,		19, 0 },	\
+	{ 26,	"content-encoding",	NULL,		16, 0 },	\
+	{ 27,	"content-language",	NULL,		16, 0 },	\
+	{ 28,	"content-length",	NULL,		14, 0 },	\
+	{ 29,	"content-location",	NULL,		16, 0 },	\
+	{ 30,	"content-range",	NULL,		13, 0 },	\
+	{ 31,	"content-type",		NULL,		12, 0 },	\
+	{ 32,	"cookie",		NULL,		6, 0 },		\
+	{ 33,	"date",			NULL,		4, 0 },		\
+	{ 34,	"etag",			NULL,		4, 0 },		\
+	{ 35,	"expect",		NULL,		6, 0 },		\
+	{ 36,	"expires",		NULL,		7, 0 },		\
+	{ 37,	"from",			NULL,		4, 0 },		\
+	{ 38,	"host",			NULL,		4, 0 },		\
+	{ 39,	"if-match",		NULL,		8, 0 },		\
+	{ 40,	"if-modified-since",	NULL,		17, 0 },	\
+	{ 41,	"if-none-match",	NULL,		13, 0 },	\
+	{ 42,	"if-range",		NULL,		8, 0 },		\
+	{ 43,	"if-unmodified-since",	NULL,		19, 0 },	\
+	{ 44,	"last-modified",	NULL,		13, 0 },	\
+	{ 45,	"link",			NULL,		4, 0 },		\
+	{ 46,	"location",		NULL,		8, 0 },		\
+	{ 47,	"max-forwards",		NULL,		12, 0 },	\
+	{ 48,	"proxy-authenticate",	NULL,		18, 0 },	\
+	{ 49,	"proxy-authorization",	NULL,		19, 0 },	\
+	{ 50,	"range",		NULL,		5, 0 },		\
+	{ 51,	"referer",		NULL,		7, 0 },		\
+	{ 52,	"refresh",		NULL,		7, 0 },		\
+	{ 53,	"retry-after",		NULL,		11, 0 },	\
+	{ 54,	"server",		NULL,		6, 0 },		\
+	{ 55,	"set-cookie",		NULL,		10, 0 },	\
+	{ 56,	"strict-transport-security", NULL,	25, 0 },	\
+	{ 57,	"transfer-encoding",	NULL,		17, 0 },	\
+	{ 58,	"user-agent",		NULL,		10, 0 },	\
+	{ 59,	"vary",			NULL,		4, 0 },		\
+	{ 60,	"via",			NULL,		3, 0 },		\
+	{ 61,	"www-authenticate",	NULL,		16, 0 },	\
 };
 
 /*
@@ -0,0 +1,2058 @@
+/*	$OpenBSD$	*/
+
+/*
+ * Generated by hpackgen from hpack.h, do not edit.
+ */
+
+#ifndef HPACK_TABLES_H
+#define HPACK_TABLES_H
+
+/*
+ * Perfect hash of the static table names (128 slots).
+ */
+#define HPACK_STATIC_HASH_MUL	0x94b2de53U
+
+static const struct hpack_static_hash static_hash[] = {
+	{ 0,	0,	0 },
+	{ 33,	1,	4 },	/* date */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 21,	1,	3 },	/* age */
+	{ 32,	1,	6 },	/* cookie */
+	{ 37,	1,	4 },	/* from */
+	{ 41,	1,	13 },	/* if-none-match */
+	{ 0,	0,	0 },
+	{ 45,	1,	4 },	/* link */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 20,	1,	27 },	/* access-control-allow-origin */
+	{ 0,	0,	0 },
+	{ 30,	1,	13 },	/* content-range */
+	{ 52,	1,	7 },	/* refresh */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 35,	1,	6 },	/* expect */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 24,	1,	13 },	/* cache-control */
+	{ 0,	0,	0 },
+	{ 59,	1,	4 },	/* vary */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 22,	1,	5 },	/* allow */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 31,	1,	12 },	/* content-type */
+	{ 6,	2,	7 },	/* :scheme (7) */
+	{ 4,	2,	5 },	/* :path (5) */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 46,	1,	8 },	/* location */
+	{ 15,	1,	14 },	/* accept-charset */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 56,	1,	25 },	/* strict-transport-security */
+	{ 0,	0,	0 },
+	{ 19,	1,	6 },	/* accept */
+	{ 0,	0,	0 },
+	{ 47,	1,	12 },	/* max-forwards */
+	{ 0,	0,	0 },
+	{ 60,	1,	3 },	/* via */
+	{ 8,	7,	7 },	/* :status (9) (10) (11) (12) (13) (14) */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 53,	1,	11 },	/* retry-after */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 36,	1,	7 },	/* expires */
+	{ 0,	0,	0 },
+	{ 17,	1,	15 },	/* accept-language */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 1,	1,	10 },	/* :authority */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 38,	1,	4 },	/* host */
+	{ 43,	1,	19 },	/* if-unmodified-since */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 48,	1,	18 },	/* proxy-authenticate */
+	{ 0,	0,	0 },
+	{ 25,	1,	19 },	/* content-disposition */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 16,	1,	15 },	/* accept-encoding */
+	{ 0,	0,	0 },
+	{ 57,	1,	17 },	/* transfer-encoding */
+	{ 49,	1,	19 },	/* proxy-authorization */
+	{ 50,	1,	5 },	/* range */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 2,	2,	7 },	/* :method (3) */
+	{ 55,	1,	10 },	/* set-cookie */
+	{ 61,	1,	16 },	/* www-authenticate */
+	{ 0,	0,	0 },
+	{ 39,	1,	8 },	/* if-match */
+	{ 27,	1,	16 },	/* content-language */
+	{ 28,	1,	14 },	/* content-length */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 54,	1,	6 },	/* server */
+	{ 0,	0,	0 },
+	{ 40,	1,	17 },	/* if-modified-since */
+	{ 0,	0,	0 },
+	{ 58,	1,	10 },	/* user-agent */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 44,	1,	13 },	/* last-modified */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 18,	1,	13 },	/* accept-ranges */
+	{ 34,	1,	4 },	/* etag */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 26,	1,	16 },	/* content-encoding */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+	{ 51,	1,	7 },	/* referer */
+	{ 23,	1,	13 },	/* authorization */
+	{ 29,	1,	16 },	/* content-location */
+	{ 0,	0,	0 },
+	{ 42,	1,	8 },	/* if-range */
+	{ 0,	0,	0 },
+	{ 0,	0,	0 },
+};
+
+/*
+ * Token of the name of each static table entry.
+ */
+static const unsigned char static_token[] = {
+	0,	/* unknown */
+	1,	/* 1 :authority */
+	2,	/* 2 :method */
+	2,	/* 3 :method */
+	4,	/* 4 :path */
+	4,	/* 5 :path */
+	6,	/* 6 :scheme */
+	6,	/* 7 :scheme */
+	8,	/* 8 :status */
+	8,	/* 9 :status */
+	8,	/* 10 :status */
+	8,	/* 11 :status */
+	8,	/* 12 :status */
+	8,	/* 13 :status */
+	8,	/* 14 :status */
+	15,	/* 15 accept-charset */
+	16,	/* 16 accept-encoding */
+	17,	/* 17 accept-language */
+	18,	/* 18 accept-ranges */
+	19,	/* 19 accept */
+	20,	/* 20 access-control-allow-origin */
+	21,	/* 21 age */
+	22,	/* 22 allow */
+	23,	/* 23 authorization */
+	24,	/* 24 cache-control */
+	25,	/* 25 content-disposition */
+	26,	/* 26 content-encoding */
+	27,	/* 27 content-language */
+	28,	/* 28 content-length */
+	29,	/* 29 content-location */
+	30,	/* 30 content-range */
+	31,	/* 31 content-type */
+	32,	/* 32 cookie */
+	33,	/* 33 date */
+	34,	/* 34 etag */
+	35,	/* 35 expect */
+	36,	/* 36 expires */
+	37,	/* 37 from */
+	38,	/* 38 host */
+	39,	/* 39 if-match */
+	40,	/* 40 if-modified-since */
+	41,	/* 41 if-none-match */
+	42,	/* 42 if-range */
+	43,	/* 43 if-unmodified-since */
+	44,	/* 44 last-modified */
+	45,	/* 45 link */
+	46,	/* 46 location */
+	47,	/* 47 max-forwards */
+	48,	/* 48 proxy-authenticate */
+	49,	/* 49 proxy-authorization */
+	50,	/* 50 range */
+	51,	/* 51 referer */
+	52,	/* 52 refresh */
+	53,	/* 53 retry-after */
+	54,	/* 54 server */
+	55,	/* 55 set-cookie */
+	56,	/* 56 strict-transport-security */
+	57,	/* 57 transfer-encoding */
+	58,	/* 58 user-agent */
+	59,	/* 59 vary */
+	60,	/* 60 via */
+	61,	/* 61 www-authenticate */
+};
+
+#ifndef HPACK_HUFFMAN_TREE
+/*
+ * Huffman decoding state machine (256 states, 4 bits per step).
+ */
+static const struct hpack_huffman_state huffman_fsm[256][16] = {
+	{ /* 0 */
+		{ 87, 0, 0 }, { 88, 0, 0 }, { 131, 0, 0 }, { 135, 0, 0 },
+		{ 143, 0, 0 }, { 69, 0, 0 }, { 83, 0, 0 }, { 90, 0, 0 },
+		{ 100, 0, 0 }, { 132, 0, 0 }, { 138, 0, 0 }, { 95, 0, 0 },
+		{ 105, 0, 0 }, { 112, 0, 0 }, { 119, 0, 0 }, { 4, 2, 0 },
+	},
+	{ /* 1 */
+		{ 101, 0, 0 }, { 129, 0, 0 }, { 133, 0, 0 }, { 134, 0, 0 },
+		{ 139, 0, 0 }, { 140, 0, 0 }, { 142, 0, 0 }, { 96, 0, 0 },
+		{ 106, 0, 0 }, { 109, 0, 0 }, { 113, 0, 0 }, { 116, 0, 0 },
+		{ 120, 0, 0 }, { 136, 0, 0 }, { 144, 0, 0 }, { 5, 2, 0 },
+	},
+	{ /* 2 */
+		{ 107, 0, 0 }, { 108, 0, 0 }, { 110, 0, 0 }, { 111, 0, 0 },
+		{ 114, 0, 0 }, { 115, 0, 0 }, { 117, 0, 0 }, { 118, 0, 0 },
+		{ 121, 0, 0 }, { 122, 0, 0 }, { 137, 0, 0 }, { 141, 0, 0 },
+		{ 145, 0, 0 }, { 146, 0, 0 }, { 75, 0, 0 }, { 6, 2, 0 },
+	},
+	{ /* 3 */
+		{ 0, 3, 85 }, { 0, 3, 86 }, { 0, 3, 87 }, { 0, 3, 89 },
+		{ 0, 3, 106 }, { 0, 3, 107 }, { 0, 3, 113 }, { 0, 3, 118 },
+		{ 0, 3, 119 }, { 0, 3, 120 }, { 0, 3, 121 }, { 0, 3, 122 },
+		{ 76, 0, 0 }, { 80, 0, 0 }, { 123, 0, 0 }, { 7, 2, 0 },
+	},
+	{ /* 4 */
+		{ 66, 1, 119 }, { 1, 3, 119 }, { 66, 1, 120 }, { 1, 3, 120 },
+		{ 66, 1, 121 }, { 1, 3, 121 }, { 66, 1, 122 }, { 1, 3, 122 },
+		{ 0, 3, 38 }, { 0, 3, 42 }, { 0, 3, 44 }, { 0, 3, 59 },
+		{ 0, 3, 88 }, { 0, 3, 90 }, { 71, 0, 0 }, { 8, 0, 0 },
+	},
+	{ /* 5 */
+		{ 66, 1, 38 }, { 1, 3, 38 }, { 66, 1, 42 }, { 1, 3, 42 },
+		{ 66, 1, 44 }, { 1, 3, 44 }, { 66, 1, 59 }, { 1, 3, 59 },
+		{ 66, 1, 88 }, { 1, 3, 88 }, { 66, 1, 90 }, { 1, 3, 90 },
+		{ 72, 0, 0 }, { 79, 0, 0 }, { 77, 0, 0 }, { 9, 0, 0 },
+	},
+	{ /* 6 */
+		{ 85, 1, 88 }, { 67, 1, 88 }, { 93, 1, 88 }, { 2, 3, 88 },
+		{ 85, 1, 90 }, { 67, 1, 90 }, { 93, 1, 90 }, { 2, 3, 90 },
+		{ 0, 3, 33 }, { 0, 3, 34 }, { 0, 3, 40 }, { 0, 3, 41 },
+		{ 0, 3, 63 }, { 78, 0, 0 }, { 73, 0, 0 }, { 10, 0, 0 },
+	},
+	{ /* 7 */
+		{ 66, 1, 33 }, { 1, 3, 33 }, { 66, 1, 34 }, { 1, 3, 34 },
+		{ 66, 1, 40 }, { 1, 3, 40 }, { 66, 1, 41 }, { 1, 3, 41 },
+		{ 66, 1, 63 }, { 1, 3, 63 }, { 0, 3, 39 }, { 0, 3, 43 },
+		{ 0, 3, 124 }, { 74, 0, 0 }, { 11, 0, 0 }, { 13, 0, 0 },
+	},
+	{ /* 8 */
+		{ 85, 1, 63 }, { 67, 1, 63 }, { 93, 1, 63 }, { 2, 3, 63 },
+		{ 66, 1, 39 }, { 1, 3, 39 }, { 66, 1, 43 }, { 1, 3, 43 },
+		{ 66, 1, 124 }, { 1, 3, 124 }, { 0, 3, 35 }, { 0, 3, 62 },
+		{ 12, 0, 0 }, { 102, 0, 0 }, { 127, 0, 0 }, { 14, 0, 0 },
+	},
+	{ /* 9 */
+		{ 85, 1, 124 }, { 67, 1, 124 }, { 93, 1, 124 }, { 2, 3, 124 },
+		{ 66, 1, 35 }, { 1, 3, 35 }, { 66, 1, 62 }, { 1, 3, 62 },
+		{ 0, 3, 0 }, { 0, 3, 36 }, { 0, 3, 64 }, { 0, 3, 91 },
+		{ 0, 3, 93 }, { 0, 3, 126 }, { 128, 0, 0 }, { 15, 0, 0 },
+	},
+	{ /* 10 */
+		{ 66, 1, 0 }, { 1, 3, 0 }, { 66, 1, 36 }, { 1, 3, 36 },
+		{ 66, 1, 64 }, { 1, 3, 64 }, { 66, 1, 91 }, { 1, 3, 91 },
+		{ 66, 1, 93 }, { 1, 3, 93 }, { 66, 1, 126 }, { 1, 3, 126 },
+		{ 0, 3, 94 }, { 0, 3, 125 }, { 98, 0, 0 }, { 16, 0, 0 },
+	},
+	{ /* 11 */
+		{ 85, 1, 0 }, { 67, 1, 0 }, { 93, 1, 0 }, { 2, 3, 0 },
+		{ 85, 1, 36 }, { 67, 1, 36 }, { 93, 1, 36 }, { 2, 3, 36 },
+		{ 85, 1, 64 }, { 67, 1, 64 }, { 93, 1, 64 }, { 2, 3, 64 },
+		{ 85, 1, 91 }, { 67, 1, 91 }, { 93, 1, 91 }, { 2, 3, 91 },
+	},
+	{ /* 12 */
+		{ 86, 1, 0 }, { 130, 1, 0 }, { 68, 1, 0 }, { 82, 1, 0 },
+		{ 99, 1, 0 }, { 94, 1, 0 }, { 104, 1, 0 }, { 3, 3, 0 },
+		{ 86, 1, 36 }, { 130, 1, 36 }, { 68, 1, 36 }, { 82, 1, 36 },
+		{ 99, 1, 36 }, { 94, 1, 36 }, { 104, 1, 36 }, { 3, 3, 36 },
+	},
+	{ /* 13 */
+		{ 85, 1, 93 }, { 67, 1, 93 }, { 93, 1, 93 }, { 2, 3, 93 },
+		{ 85, 1, 126 }, { 67, 1, 126 }, { 93, 1, 126 }, { 2, 3, 126 },
+		{ 66, 1, 94 }, { 1, 3, 94 }, { 66, 1, 125 }, { 1, 3, 125 },
+		{ 0, 3, 60 }, { 0, 3, 96 }, { 0, 3, 123 }, { 17, 0, 0 },
+	},
+	{ /* 14 */
+		{ 85, 1, 94 }, { 67, 1, 94 }, { 93, 1, 94 }, { 2, 3, 94 },
+		{ 85, 1, 125 }, { 67, 1, 125 }, { 93, 1, 125 }, { 2, 3, 125 },
+		{ 66, 1, 60 }, { 1, 3, 60 }, { 66, 1, 96 }, { 1, 3, 96 },
+		{ 66, 1, 123 }, { 1, 3, 123 }, { 124, 0, 0 }, { 18, 0, 0 },
+	},
+	{ /* 15 */
+		{ 85, 1, 60 }, { 67, 1, 60 }, { 93, 1, 60 }, { 2, 3, 60 },
+		{ 85, 1, 96 }, { 67, 1, 96 }, { 93, 1, 96 }, { 2, 3, 96 },
+		{ 85, 1, 123 }, { 67, 1, 123 }, { 93, 1, 123 }, { 2, 3, 123 },
+		{ 125, 0, 0 }, { 155, 0, 0 }, { 150, 0, 0 }, { 19, 0, 0 },
+	},
+	{ /* 16 */
+		{ 86, 1, 123 }, { 130, 1, 123 }, { 68, 1, 123 }, { 82, 1, 123 },
+		{ 99, 1, 123 }, { 94, 1, 123 }, { 104, 1, 123 }, { 3, 3, 123 },
+		{ 126, 0, 0 }, { 148, 0, 0 }, { 156, 0, 0 }, { 175, 0, 0 },
+		{ 196, 0, 0 }, { 151, 0, 0 }, { 20, 0, 0 }, { 25, 0, 0 },
+	},
+	{ /* 17 */
+		{ 0, 3, 92 }, { 0, 3, 195 }, { 0, 3, 208 }, { 149, 0, 0 },
+		{ 157, 0, 0 }, { 204, 0, 0 }, { 241, 0, 0 }, { 176, 0, 0 },
+		{ 197, 0, 0 }, { 235, 0, 0 }, { 152, 0, 0 }, { 178, 0, 0 },
+		{ 199, 0, 0 }, { 21, 0, 0 }, { 167, 0, 0 }, { 26, 0, 0 },
+	},
+	{ /* 18 */
+		{ 198, 0, 0 }, { 202, 0, 0 }, { 236, 0, 0 }, { 242, 0, 0 },
+		{ 153, 0, 0 }, { 158, 0, 0 }, { 179, 0, 0 }, { 183, 0, 0 },
+		{ 200, 0, 0 }, { 206, 0, 0 }, { 216, 0, 0 }, { 22, 0, 0 },
+		{ 168, 0, 0 }, { 185, 0, 0 }, { 41, 0, 0 }, { 27, 0, 0 },
+	},
+	{ /* 19 */
+		{ 201, 0, 0 }, { 205, 0, 0 }, { 207, 0, 0 }, { 210, 0, 0 },
+		{ 217, 0, 0 }, { 243, 0, 0 }, { 23, 0, 0 }, { 162, 0, 0 },
+		{ 169, 0, 0 }, { 173, 0, 0 }, { 186, 0, 0 }, { 194, 0, 0 },
+		{ 208, 0, 0 }, { 42, 0, 0 }, { 191, 0, 0 }, { 28, 0, 0 },
+	},
+	{ /* 20 */
+		{ 0, 3, 178 }, { 0, 3, 181 }, { 0, 3, 185 }, { 0, 3, 186 },
+		{ 0, 3, 187 }, { 0, 3, 189 }, { 0, 3, 190 }, { 0, 3, 196 },
+		{ 0, 3, 198 }, { 0, 3, 228 }, { 0, 3, 232 }, { 0, 3, 233 },
+		{ 24, 0, 0 }, { 161, 0, 0 }, { 163, 0, 0 }, { 164, 0, 0 },
+	},
+	{ /* 21 */
+		{ 66, 1, 198 }, { 1, 3, 198 }, { 66, 1, 228 }, { 1, 3, 228 },
+		{ 66, 1, 232 }, { 1, 3, 232 }, { 66, 1, 233 }, { 1, 3, 233 },
+		{ 0, 3, 1 }, { 0, 3, 135 }, { 0, 3, 137 }, { 0, 3, 138 },
+		{ 0, 3, 139 }, { 0, 3, 140 }, { 0, 3, 141 }, { 0, 3, 143 },
+	},
+	{ /* 22 */
+		{ 66, 1, 1 }, { 1, 3, 1 }, { 66, 1, 135 }, { 1, 3, 135 },
+		{ 66, 1, 137 }, { 1, 3, 137 }, { 66, 1, 138 }, { 1, 3, 138 },
+		{ 66, 1, 139 }, { 1, 3, 139 }, { 66, 1, 140 }, { 1, 3, 140 },
+		{ 66, 1, 141 }, { 1, 3, 141 }, { 66, 1, 143 }, { 1, 3, 143 },
+	},
+	{ /* 23 */
+		{ 85, 1, 1 }, { 67, 1, 1 }, { 93, 1, 1 }, { 2, 3, 1 },
+		{ 85, 1, 135 }, { 67, 1, 135 }, { 93, 1, 135 }, { 2, 3, 135 },
+		{ 85, 1, 137 }, { 67, 1, 137 }, { 93, 1, 137 }, { 2, 3, 137 },
+		{ 85, 1, 138 }, { 67, 1, 138 }, { 93, 1, 138 }, { 2, 3, 138 },
+	},
+	{ /* 24 */
+		{ 86, 1, 1 }, { 130, 1, 1 }, { 68, 1, 1 }, { 82, 1, 1 },
+		{ 99, 1, 1 }, { 94, 1, 1 }, { 104, 1, 1 }, { 3, 3, 1 },
+		{ 86, 1, 135 }, { 130, 1, 135 }, { 68, 1, 135 }, { 82, 1, 135 },
+		{ 99, 1, 135 }, { 94, 1, 135 }, { 104, 1, 135 }, { 3, 3, 135 },
+	},
+	{ /* 25 */
+		{ 170, 0, 0 }, { 172, 0, 0 }, { 174, 0, 0 }, { 181, 0, 0 },
+		{ 187, 0, 0 }, { 189, 0, 0 }, { 195, 0, 0 }, { 203, 0, 0 },
+		{ 209, 0, 0 }, { 215, 0, 0 }, { 43, 0, 0 }, { 165, 0, 0 },
+		{ 192, 0, 0 }, { 218, 0, 0 }, { 211, 0, 0 }, { 29, 0, 0 },
+	},
+	{ /* 26 */
+		{ 0, 3, 188 }, { 0, 3, 191 }, { 0, 3, 197 }, { 0, 3, 231 },
+		{ 0, 3, 239 }, { 44, 0, 0 }, { 166, 0, 0 }, { 171, 0, 0 },
+		{ 193, 0, 0 }, { 234, 0, 0 }, { 245, 0, 0 }, { 219, 0, 0 },
+		{ 212, 0, 0 }, { 224, 0, 0 }, { 229, 0, 0 }, { 30, 0, 0 },
+	},
+	{ /* 27 */
+		{ 0, 3, 171 }, { 0, 3, 206 }, { 0, 3, 215 }, { 0, 3, 225 },
+		{ 0, 3, 236 }, { 0, 3, 237 }, { 220, 0, 0 }, { 244, 0, 0 },
+		{ 213, 0, 0 }, { 222, 0, 0 }, { 237, 0, 0 }, { 225, 0, 0 },
+		{ 230, 0, 0 }, { 249, 0, 0 }, { 31, 0, 0 }, { 45, 0, 0 },
+	},
+	{ /* 28 */
+		{ 214, 0, 0 }, { 221, 0, 0 }, { 223, 0, 0 }, { 228, 0, 0 },
+		{ 238, 0, 0 }, { 246, 0, 0 }, { 248, 0, 0 }, { 226, 0, 0 },
+		{ 231, 0, 0 }, { 239, 0, 0 }, { 250, 0, 0 }, { 253, 0, 0 },
+		{ 32, 0, 0 }, { 38, 0, 0 }, { 55, 0, 0 }, { 46, 0, 0 },
+	},
+	{ /* 29 */
+		{ 232, 0, 0 }, { 233, 0, 0 }, { 240, 0, 0 }, { 247, 0, 0 },
+		{ 251, 0, 0 }, { 252, 0, 0 }, { 254, 0, 0 }, { 255, 0, 0 },
+		{ 33, 0, 0 }, { 35, 0, 0 }, { 39, 0, 0 }, { 52, 0, 0 },
+		{ 56, 0, 0 }, { 60, 0, 0 }, { 63, 0, 0 }, { 47, 0, 0 },
+	},
+	{ /* 30 */
+		{ 0, 3, 254 }, { 34, 0, 0 }, { 36, 0, 0 }, { 37, 0, 0 },
+		{ 40, 0, 0 }, { 51, 0, 0 }, { 53, 0, 0 }, { 54, 0, 0 },
+		{ 57, 0, 0 }, { 58, 0, 0 }, { 61, 0, 0 }, { 62, 0, 0 },
+		{ 64, 0, 0 }, { 65, 0, 0 }, { 147, 0, 0 }, { 48, 0, 0 },
+	},
+	{ /* 31 */
+		{ 66, 1, 254 }, { 1, 3, 254 }, { 0, 3, 2 }, { 0, 3, 3 },
+		{ 0, 3, 4 }, { 0, 3, 5 }, { 0, 3, 6 }, { 0, 3, 7 },
+		{ 0, 3, 8 }, { 0, 3, 11 }, { 0, 3, 12 }, { 0, 3, 14 },
+		{ 0, 3, 15 }, { 0, 3, 16 }, { 0, 3, 17 }, { 0, 3, 18 },
+	},
+	{ /* 32 */
+		{ 85, 1, 254 }, { 67, 1, 254 }, { 93, 1, 254 }, { 2, 3, 254 },
+		{ 66, 1, 2 }, { 1, 3, 2 }, { 66, 1, 3 }, { 1, 3, 3 },
+		{ 66, 1, 4 }, { 1, 3, 4 }, { 66, 1, 5 }, { 1, 3, 5 },
+		{ 66, 1, 6 }, { 1, 3, 6 }, { 66, 1, 7 }, { 1, 3, 7 },
+	},
+	{ /* 33 */
+		{ 86, 1, 254 }, { 130, 1, 254 }, { 68, 1, 254 }, { 82, 1, 254 },
+		{ 99, 1, 254 }, { 94, 1, 254 }, { 104, 1, 254 }, { 3, 3, 254 },
+		{ 85, 1, 2 }, { 67, 1, 2 }, { 93, 1, 2 }, { 2, 3, 2 },
+		{ 85, 1, 3 }, { 67, 1, 3 }, { 93, 1, 3 }, { 2, 3, 3 },
+	},
+	{ /* 34 */
+		{ 86, 1, 2 }, { 130, 1, 2 }, { 68, 1, 2 }, { 82, 1, 2 },
+		{ 99, 1, 2 }, { 94, 1, 2 }, { 104, 1, 2 }, { 3, 3, 2 },
+		{ 86, 1, 3 }, { 130, 1, 3 }, { 68, 1, 3 }, { 82, 1, 3 },
+		{ 99, 1, 3 }, { 94, 1, 3 }, { 104, 1, 3 }, { 3, 3, 3 },
+	},
+	{ /* 35 */
+		{ 85, 1, 4 }, { 67, 1, 4 }, { 93, 1, 4 }, { 2, 3, 4 },
+		{ 85, 1, 5 }, { 67, 1, 5 }, { 93, 1, 5 }, { 2, 3, 5 },
+		{ 85, 1, 6 }, { 67, 1, 6 }, { 93, 1, 6 }, { 2, 3, 6 },
+		{ 85, 1, 7 }, { 67, 1, 7 }, { 93, 1, 7 }, { 2, 3, 7 },
+	},
+	{ /* 36 */
+		{ 86, 1, 4 }, { 130, 1, 4 }, { 68, 1, 4 }, { 82, 1, 4 },
+		{ 99, 1, 4 }, { 94, 1, 4 }, { 104, 1, 4 }, { 3, 3, 4 },
+		{ 86, 1, 5 }, { 130, 1, 5 }, { 68, 1, 5 }, { 82, 1, 5 },
+		{ 99, 1, 5 }, { 94, 1, 5 }, { 104, 1, 5 }, { 3, 3, 5 },
+	},
+	{ /* 37 */
+		{ 86, 1, 6 }, { 130, 1, 6 }, { 68, 1, 6 }, { 82, 1, 6 },
+		{ 99, 1, 6 }, { 94, 1, 6 }, { 104, 1, 6 }, { 3, 3, 6 },
+		{ 86, 1, 7 }, { 130, 1, 7 }, { 68, 1, 7 }, { 82, 1, 7 },
+		{ 99, 1, 7 }, { 94, 1, 7 }, { 104, 1, 7 }, { 3, 3, 7 },
+	},
+	{ /* 38 */
+		{ 66, 1, 8 }, { 1, 3, 8 }, { 66, 1, 11 }, { 1, 3, 11 },
+		{ 66, 1, 12 }, { 1, 3, 12 }, { 66, 1, 14 }, { 1, 3, 14 },
+		{ 66, 1, 15 }, { 1, 3, 15 }, { 66, 1, 16 }, { 1, 3, 16 },
+		{ 66, 1, 17 }, { 1, 3, 17 }, { 66, 1, 18 }, { 1, 3, 18 },
+	},
+	{ /* 39 */
+		{ 85, 1, 8 }, { 67, 1, 8 }, { 93, 1, 8 }, { 2, 3, 8 },
+		{ 85, 1, 11 }, { 67, 1, 11 }, { 93, 1, 11 }, { 2, 3, 11 },
+		{ 85, 1, 12 }, { 67, 1, 12 }, { 93, 1, 12 }, { 2, 3, 12 },
+		{ 85, 1, 14 }, { 67, 1, 14 }, { 93, 1, 14 }, { 2, 3, 14 },
+	},
+	{ /* 40 */
+		{ 86, 1, 8 }, { 130, 1, 8 }, { 68, 1, 8 }, { 82, 1, 8 },
+		{ 99, 1, 8 }, { 94, 1, 8 }, { 104, 1, 8 }, { 3, 3, 8 },
+		{ 86, 1, 11 }, { 130, 1, 11 }, { 68, 1, 11 }, { 82, 1, 11 },
+		{ 99, 1, 11 }, { 94, 1, 11 }, { 104, 1, 11 }, { 3, 3, 11 },
+	},
+	{ /* 41 */
+		{ 66, 1, 188 }, { 1, 3, 188 }, { 66, 1, 191 }, { 1, 3, 191 },
+		{ 66, 1, 197 }, { 1, 3, 197 }, { 66, 1, 231 }, { 1, 3, 231 },
+		{ 66, 1, 239 }, { 1, 3, 239 }, { 0, 3, 9 }, { 0, 3, 142 },
+		{ 0, 3, 144 }, { 0, 3, 145 }, { 0, 3, 148 }, { 0, 3, 159 },
+	},
+	{ /* 42 */
+		{ 85, 1, 239 }, { 67, 1, 239 }, { 93, 1, 239 }, { 2, 3, 239 },
+		{ 66, 1, 9 }, { 1, 3, 9 }, { 66, 1, 142 }, { 1, 3, 142 },
+		{ 66, 1, 144 }, { 1, 3, 144 }, { 66, 1, 145 }, { 1, 3, 145 },
+		{ 66, 1, 148 }, { 1, 3, 148 }, { 66, 1, 159 }, { 1, 3, 159 },
+	},
+	{ /* 43 */
+		{ 86, 1, 239 }, { 130, 1, 239 }, { 68, 1, 239 }, { 82, 1, 239 },
+		{ 99, 1, 239 }, { 94, 1, 239 }, { 104, 1, 239 }, { 3, 3, 239 },
+		{ 85, 1, 9 }, { 67, 1, 9 }, { 93, 1, 9 }, { 2, 3, 9 },
+		{ 85, 1, 142 }, { 67, 1, 142 }, { 93, 1, 142 }, { 2, 3, 142 },
+	},
+	{ /* 44 */
+		{ 86, 1, 9 }, { 130, 1, 9 }, { 68, 1, 9 }, { 82, 1, 9 },
+		{ 99, 1, 9 }, { 94, 1, 9 }, { 104, 1, 9 }, { 3, 3, 9 },
+		{ 86, 1, 142 }, { 130, 1, 142 }, { 68, 1, 142 }, { 82, 1, 142 },
+		{ 99, 1, 142 }, { 94, 1, 142 }, { 104, 1, 142 }, { 3, 3, 142 },
+	},
+	{ /* 45 */
+		{ 0, 3, 19 }, { 0, 3, 20 }, { 0, 3, 21 }, { 0, 3, 23 },
+		{ 0, 3, 24 }, { 0, 3, 25 }, { 0, 3, 26 }, { 0, 3, 27 },
+		{ 0, 3, 28 }, { 0, 3, 29 }, { 0, 3, 30 }, { 0, 3, 31 },
+		{ 0, 3, 127 }, { 0, 3, 220 }, { 0, 3, 249 }, { 49, 0, 0 },
+	},
+	{ /* 46 */
+		{ 66, 1, 28 }, { 1, 3, 28 }, { 66, 1, 29 }, { 1, 3, 29 },
+		{ 66, 1, 30 }, { 1, 3, 30 }, { 66, 1, 31 }, { 1, 3, 31 },
+		{ 66, 1, 127 }, { 1, 3, 127 }, { 66, 1, 220 }, { 1, 3, 220 },
+		{ 66, 1, 249 }, { 1, 3, 249 }, { 50, 0, 0 }, { 59, 0, 0 },
+	},
+	{ /* 47 */
+		{ 85, 1, 127 }, { 67, 1, 127 }, { 93, 1, 127 }, { 2, 3, 127 },
+		{ 85, 1, 220 }, { 67, 1, 220 }, { 93, 1, 220 }, { 2, 3, 220 },
+		{ 85, 1, 249 }, { 67, 1, 249 }, { 93, 1, 249 }, { 2, 3, 249 },
+		{ 0, 3, 10 }, { 0, 3, 13 }, { 0, 3, 22 }, { 0, 4, 0 },
+	},
+	{ /* 48 */
+		{ 86, 1, 249 }, { 130, 1, 249 }, { 68, 1, 249 }, { 82, 1, 249 },
+		{ 99, 1, 249 }, { 94, 1, 249 }, { 104, 1, 249 }, { 3, 3, 249 },
+		{ 66, 1, 10 }, { 1, 3, 10 }, { 66, 1, 13 }, { 1, 3, 13 },
+		{ 66, 1, 22 }, { 1, 3, 22 }, { 0, 4, 0 }, { 0, 4, 0 },
+	},
+	{ /* 49 */
+		{ 85, 1, 10 }, { 67, 1, 10 }, { 93, 1, 10 }, { 2, 3, 10 },
+		{ 85, 1, 13 }, { 67, 1, 13 }, { 93, 1, 13 }, { 2, 3, 13 },
+		{ 85, 1, 22 }, { 67, 1, 22 }, { 93, 1, 22 }, { 2, 3, 22 },
+		{ 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+	},
+	{ /* 50 */
+		{ 86, 1, 10 }, { 130, 1, 10 }, { 68, 1, 10 }, { 82, 1, 10 },
+		{ 99, 1, 10 }, { 94, 1, 10 }, { 104, 1, 10 }, { 3, 3, 10 },
+		{ 86, 1, 13 }, { 130, 1, 13 }, { 68, 1, 13 }, { 82, 1, 13 },
+		{ 99, 1, 13 }, { 94, 1, 13 }, { 104, 1, 13 }, { 3, 3, 13 },
+	},
+	{ /* 51 */
+		{ 86, 1, 12 }, { 130, 1, 12 }, { 68, 1, 12 }, { 82, 1, 12 },
+		{ 99, 1, 12 }, { 94, 1, 12 }, { 104, 1, 12 }, { 3, 3, 12 },
+		{ 86, 1, 14 }, { 130, 1, 14 }, { 68, 1, 14 }, { 82, 1, 14 },
+		{ 99, 1, 14 }, { 94, 1, 14 }, { 104, 1, 14 }, { 3, 3, 14 },
+	},
+	{ /* 52 */
+		{ 85, 1, 15 }, { 67, 1, 15 }, { 93, 1, 15 }, { 2, 3, 15 },
+		{ 85, 1, 16 }, { 67, 1, 16 }, { 93, 1, 16 }, { 2, 3, 16 },
+		{ 85, 1, 17 }, { 67, 1, 17 }, { 93, 1, 17 }, { 2, 3, 17 },
+		{ 85, 1, 18 }, { 67, 1, 18 }, { 93, 1, 18 }, { 2, 3, 18 },
+	},
+	{ /* 53 */
+		{ 86, 1, 15 }, { 130, 1, 15 }, { 68, 1, 15 }, { 82, 1, 15 },
+		{ 99, 1, 15 }, { 94, 1, 15 }, { 104, 1, 15 }, { 3, 3, 15 },
+		{ 86, 1, 16 }, { 130, 1, 16 }, { 68, 1, 16 }, { 82, 1, 16 },
+		{ 99, 1, 16 }, { 94, 1, 16 }, { 104, 1, 16 }, { 3, 3, 16 },
+	},
+	{ /* 54 */
+		{ 86, 1, 17 }, { 130, 1, 17 }, { 68, 1, 17 }, { 82, 1, 17 },
+		{ 99, 1, 17 }, { 94, 1, 17 }, { 104, 1, 17 }, { 3, 3, 17 },
+		{ 86, 1, 18 }, { 130, 1, 18 }, { 68, 1, 18 }, { 82, 1, 18 },
+		{ 99, 1, 18 }, { 94, 1, 18 }, { 104, 1, 18 }, { 3, 3, 18 },
+	},
+	{ /* 55 */
+		{ 66, 1, 19 }, { 1, 3, 19 }, { 66, 1, 20 }, { 1, 3, 20 },
+		{ 66, 1, 21 }, { 1, 3, 21 }, { 66, 1, 23 }, { 1, 3, 23 },
+		{ 66, 1, 24 }, { 1, 3, 24 }, { 66, 1, 25 }, { 1, 3, 25 },
+		{ 66, 1, 26 }, { 1, 3, 26 }, { 66, 1, 27 }, { 1, 3, 27 },
+	},
+	{ /* 56 */
+		{ 85, 1, 19 }, { 67, 1, 19 }, { 93, 1, 19 }, { 2, 3, 19 },
+		{ 85, 1, 20 }, { 67, 1, 20 }, { 93, 1, 20 }, { 2, 3, 20 },
+		{ 85, 1, 21 }, { 67, 1, 21 }, { 93, 1, 21 }, { 2, 3, 21 },
+		{ 85, 1, 23 }, { 67, 1, 23 }, { 93, 1, 23 }, { 2, 3, 23 },
+	},
+	{ /* 57 */
+		{ 86, 1, 19 }, { 130, 1, 19 }, { 68, 1, 19 }, { 82, 1, 19 },
+		{ 99, 1, 19 }, { 94, 1, 19 }, { 104, 1, 19 }, { 3, 3, 19 },
+		{ 86, 1, 20 }, { 130, 1, 20 }, { 68, 1, 20 }, { 82, 1, 20 },
+		{ 99, 1, 20 }, { 94, 1, 20 }, { 104, 1, 20 }, { 3, 3, 20 },
+	},
+	{ /* 58 */
+		{ 86, 1, 21 }, { 130, 1, 21 }, { 68, 1, 21 }, { 82, 1, 21 },
+		{ 99, 1, 21 }, { 94, 1, 21 }, { 104, 1, 21 }, { 3, 3, 21 },
+		{ 86, 1, 23 }, { 130, 1, 23 }, { 68, 1, 23 }, { 82, 1, 23 },
+		{ 99, 1, 23 }, { 94, 1, 23 }, { 104, 1, 23 }, { 3, 3, 23 },
+	},
+	{ /* 59 */
+		{ 86, 1, 22 }, { 130, 1, 22 }, { 68, 1, 22 }, { 82, 1, 22 },
+		{ 99, 1, 22 }, { 94, 1, 22 }, { 104, 1, 22 }, { 3, 3, 22 },
+		{ 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+		{ 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 }, { 0, 4, 0 },
+	},
+	{ /* 60 */
+		{ 85, 1, 24 }, { 67, 1, 24 }, { 93, 1, 24 }, { 2, 3, 24 },
+		{ 85, 1, 25 }, { 67, 1, 25 }, { 93, 1, 25 }, { 2, 3, 25 },
+		{ 85, 1, 26 }, { 67, 1, 26 }, { 93, 1, 26 }, { 2, 3, 26 },
+		{ 85, 1, 27 }, { 67, 1, 27 }, { 93, 1, 27 }, { 2, 3, 27 },
+	},
+	{ /* 61 */
+		{ 86, 1, 24 }, { 130, 1, 24 }, { 68, 1, 24 }, { 82, 1, 24 },
+		{ 99, 1, 24 }, { 94, 1, 24 }, { 104, 1, 24 }, { 3, 3, 24 },
+		{ 86, 1, 25 }, { 130, 1, 25 }, { 68, 1, 25 }, { 82, 1, 25 },
+		{ 99, 1, 25 }, { 94, 1, 25 }, { 104, 1, 25 }, { 3, 3, 25 },
+	},
+	{ /* 62 */
+		{ 86, 1, 26 }, { 130, 1, 26 }, { 68, 1, 26 }, { 82, 1, 26 },
+		{ 99, 1, 26 }, { 94, 1, 26 }, { 104, 1, 26 }, { 3, 3, 26 },
+		{ 86, 1, 27 }, { 130, 1, 27 }, { 68, 1, 27 }, { 82, 1, 27 },
+		{ 99, 1, 27 }, { 94, 1, 27 }, { 104, 1, 27 }, { 3, 3, 27 },
+	},
+	{ /* 63 */
+		{ 85, 1, 28 }, { 67, 1, 28 }, { 93, 1, 28 }, { 2, 3, 28 },
+		{ 85, 1, 29 }, { 67, 1, 29 }, { 93, 1, 29 }, { 2, 3, 29 },
+		{ 85, 1, 30 }, { 67, 1, 30 }, { 93, 1, 30 }, { 2, 3, 30 },
+		{ 85, 1, 31 }, { 67, 1, 31 }, { 93, 1, 31 }, { 2, 3, 31 },
+	},
+	{ /* 64 */
+		{ 86, 1, 28 }, { 130, 1, 28 }, { 68, 1, 28 }, { 82, 1, 28 },
+		{ 99, 1, 28 }, { 94, 1, 28 }, { 104, 1, 28 }, { 3, 3, 28 },
+		{ 86, 1, 29 }, { 130, 1, 29 }, { 68, 1, 29 }, { 82, 1, 29 },
+		{ 99, 1, 29 }, { 94, 1, 29 }, { 104, 1, 29 }, { 3, 3, 29 },
+	},
+	{ /* 65 */
+		{ 86, 1, 30 }, { 130, 1, 30 }, { 68, 1, 30 }, { 82, 1, 30 },
+		{ 99, 1, 30 }, { 94, 1, 30 }, { 104, 1, 30 }, { 3, 3, 30 },
+		{ 86, 1, 31 }, { 130, 1, 31 }, { 68, 1, 31 }, { 82, 1, 31 },
+		{ 99, 1, 31 }, { 94, 1, 31 }, { 104, 1, 31 }, { 3, 3, 31 },
+	},
+	{ /* 66 */
+		{ 0, 3, 48 }, { 0, 3, 49 }, { 0, 3, 50 }, { 0, 3, 97 },
+		{ 0, 3, 99 }, { 0, 3, 101 }, { 0, 3, 105 }, { 0, 3, 111 },
+		{ 0, 3, 115 }, { 0, 3, 116 }, { 70, 0, 0 }, { 81, 0, 0 },
+		{ 84, 0, 0 }, { 89, 0, 0 }, { 91, 0, 0 }, { 92, 0, 0 },
+	},
+	{ /* 67 */
+		{ 66, 1, 115 }, { 1, 3, 115 }, { 66, 1, 116 }, { 1, 3, 116 },
+		{ 0, 3, 32 }, { 0, 3, 37 }, { 0, 3, 45 }, { 0, 3, 46 },
+		{ 0, 3, 47 }, { 0, 3, 51 }, { 0, 3, 52 }, { 0, 3, 53 },
+		{ 0, 3, 54 }, { 0, 3, 55 }, { 0, 3, 56 }, { 0, 3, 57 },
+	},
+	{ /* 68 */
+		{ 85, 1, 115 }, { 67, 1, 115 }, { 93, 1, 115 }, { 2, 3, 115 },
+		{ 85, 1, 116 }, { 67, 1, 116 }, { 93, 1, 116 }, { 2, 3, 116 },
+		{ 66, 1, 32 }, { 1, 3, 32 }, { 66, 1, 37 }, { 1, 3, 37 },
+		{ 66, 1, 45 }, { 1, 3, 45 }, { 66, 1, 46 }, { 1, 3, 46 },
+	},
+	{ /* 69 */
+		{ 85, 1, 32 }, { 67, 1, 32 }, { 93, 1, 32 }, { 2, 3, 32 },
+		{ 85, 1, 37 }, { 67, 1, 37 }, { 93, 1, 37 }, { 2, 3, 37 },
+		{ 85, 1, 45 }, { 67, 1, 45 }, { 93, 1, 45 }, { 2, 3, 45 },
+		{ 85, 1, 46 }, { 67, 1, 46 }, { 93, 1, 46 }, { 2, 3, 46 },
+	},
+	{ /* 70 */
+		{ 86, 1, 32 }, { 130, 1, 32 }, { 68, 1, 32 }, { 82, 1, 32 },
+		{ 99, 1, 32 }, { 94, 1, 32 }, { 104, 1, 32 }, { 3, 3, 32 },
+		{ 86, 1, 37 }, { 130, 1, 37 }, { 68, 1, 37 }, { 82, 1, 37 },
+		{ 99, 1, 37 }, { 94, 1, 37 }, { 104, 1, 37 }, { 3, 3, 37 },
+	},
+	{ /* 71 */
+		{ 85, 1, 33 }, { 67, 1, 33 }, { 93, 1, 33 }, { 2, 3, 33 },
+		{ 85, 1, 34 }, { 67, 1, 34 }, { 93, 1, 34 }, { 2, 3, 34 },
+		{ 85, 1, 40 }, { 67, 1, 40 }, { 93, 1, 40 }, { 2, 3, 40 },
+		{ 85, 1, 41 }, { 67, 1, 41 }, { 93, 1, 41 }, { 2, 3, 41 },
+	},
+	{ /* 72 */
+		{ 86, 1, 33 }, { 130, 1, 33 }, { 68, 1, 33 }, { 82, 1, 33 },
+		{ 99, 1, 33 }, { 94, 1, 33 }, { 104, 1, 33 }, { 3, 3, 33 },
+		{ 86, 1, 34 }, { 130, 1, 34 }, { 68, 1, 34 }, { 82, 1, 34 },
+		{ 99, 1, 34 }, { 94, 1, 34 }, { 104, 1, 34 }, { 3, 3, 34 },
+	},
+	{ /* 73 */
+		{ 86, 1, 124 }, { 130, 1, 124 }, { 68, 1, 124 }, { 82, 1, 124 },
+		{ 99, 1, 124 }, { 94, 1, 124 }, { 104, 1, 124 }, { 3, 3, 124 },
+		{ 85, 1, 35 }, { 67, 1, 35 }, { 93, 1, 35 }, { 2, 3, 35 },
+		{ 85, 1, 62 }, { 67, 1, 62 }, { 93, 1, 62 }, { 2, 3, 62 },
+	},
+	{ /* 74 */
+		{ 86, 1, 35 }, { 130, 1, 35 }, { 68, 1, 35 }, { 82, 1, 35 },
+		{ 99, 1, 35 }, { 94, 1, 35 }, { 104, 1, 35 }, { 3, 3, 35 },
+		{ 86, 1, 62 }, { 130, 1, 62 }, { 68, 1, 62 }, { 82, 1, 62 },
+		{ 99, 1, 62 }, { 94, 1, 62 }, { 104, 1, 62 }, { 3, 3, 62 },
+	},
+	{ /* 75 */
+		{ 85, 1, 38 }, { 67, 1, 38 }, { 93, 1, 38 }, { 2, 3, 38 },
+		{ 85, 1, 42 }, { 67, 1, 42 }, { 93, 1, 42 }, { 2, 3, 42 },
+		{ 85, 1, 44 }, { 67, 1, 44 }, { 93, 1, 44 }, { 2, 3, 44 },
+		{ 85, 1, 59 }, { 67, 1, 59 }, { 93, 1, 59 }, { 2, 3, 59 },
+	},
+	{ /* 76 */
+		{ 86, 1, 38 }, { 130, 1, 38 }, { 68, 1, 38 }, { 82, 1, 38 },
+		{ 99, 1, 38 }, { 94, 1, 38 }, { 104, 1, 38 }, { 3, 3, 38 },
+		{ 86, 1, 42 }, { 130, 1, 42 }, { 68, 1, 42 }, { 82, 1, 42 },
+		{ 99, 1, 42 }, { 94, 1, 42 }, { 104, 1, 42 }, { 3, 3, 42 },
+	},
+	{ /* 77 */
+		{ 86, 1, 63 }, { 130, 1, 63 }, { 68, 1, 63 }, { 82, 1, 63 },
+		{ 99, 1, 63 }, { 94, 1, 63 }, { 104, 1, 63 }, { 3, 3, 63 },
+		{ 85, 1, 39 }, { 67, 1, 39 }, { 93, 1, 39 }, { 2, 3, 39 },
+		{ 85, 1, 43 }, { 67, 1, 43 }, { 93, 1, 43 }, { 2, 3, 43 },
+	},
+	{ /* 78 */
+		{ 86, 1, 39 }, { 130, 1, 39 }, { 68, 1, 39 }, { 82, 1, 39 },
+		{ 99, 1, 39 }, { 94, 1, 39 }, { 104, 1, 39 }, { 3, 3, 39 },
+		{ 86, 1, 43 }, { 130, 1, 43 }, { 68, 1, 43 }, { 82, 1, 43 },
+		{ 99, 1, 43 }, { 94, 1, 43 }, { 104, 1, 43 }, { 3, 3, 43 },
+	},
+	{ /* 79 */
+		{ 86, 1, 40 }, { 130, 1, 40 }, { 68, 1, 40 }, { 82, 1, 40 },
+		{ 99, 1, 40 }, { 94, 1, 40 }, { 104, 1, 40 }, { 3, 3, 40 },
+		{ 86, 1, 41 }, { 130, 1, 41 }, { 68, 1, 41 }, { 82, 1, 41 },
+		{ 99, 1, 41 }, { 94, 1, 41 }, { 104, 1, 41 }, { 3, 3, 41 },
+	},
+	{ /* 80 */
+		{ 86, 1, 44 }, { 130, 1, 44 }, { 68, 1, 44 }, { 82, 1, 44 },
+		{ 99, 1, 44 }, { 94, 1, 44 }, { 104, 1, 44 }, { 3, 3, 44 },
+		{ 86, 1, 59 }, { 130, 1, 59 }, { 68, 1, 59 }, { 82, 1, 59 },
+		{ 99, 1, 59 }, { 94, 1, 59 }, { 104, 1, 59 }, { 3, 3, 59 },
+	},
+	{ /* 81 */
+		{ 86, 1, 45 }, { 130, 1, 45 }, { 68, 1, 45 }, { 82, 1, 45 },
+		{ 99, 1, 45 }, { 94, 1, 45 }, { 104, 1, 45 }, { 3, 3, 45 },
+		{ 86, 1, 46 }, { 130, 1, 46 }, { 68, 1, 46 }, { 82, 1, 46 },
+		{ 99, 1, 46 }, { 94, 1, 46 }, { 104, 1, 46 }, { 3, 3, 46 },
+	},
+	{ /* 82 */
+		{ 66, 1, 47 }, { 1, 3, 47 }, { 66, 1, 51 }, { 1, 3, 51 },
+		{ 66, 1, 52 }, { 1, 3, 52 }, { 66, 1, 53 }, { 1, 3, 53 },
+		{ 66, 1, 54 }, { 1, 3, 54 }, { 66, 1, 55 }, { 1, 3, 55 },
+		{ 66, 1, 56 }, { 1, 3, 56 }, { 66, 1, 57 }, { 1, 3, 57 },
+	},
+	{ /* 83 */
+		{ 85, 1, 47 }, { 67, 1, 47 }, { 93, 1, 47 }, { 2, 3, 47 },
+		{ 85, 1, 51 }, { 67, 1, 51 }, { 93, 1, 51 }, { 2, 3, 51 },
+		{ 85, 1, 52 }, { 67, 1, 52 }, { 93, 1, 52 }, { 2, 3, 52 },
+		{ 85, 1, 53 }, { 67, 1, 53 }, { 93, 1, 53 }, { 2, 3, 53 },
+	},
+	{ /* 84 */
+		{ 86, 1, 47 }, { 130, 1, 47 }, { 68, 1, 47 }, { 82, 1, 47 },
+		{ 99, 1, 47 }, { 94, 1, 47 }, { 104, 1, 47 }, { 3, 3, 47 },
+		{ 86, 1, 51 }, { 130, 1, 51 }, { 68, 1, 51 }, { 82, 1, 51 },
+		{ 99, 1, 51 }, { 94, 1, 51 }, { 104, 1, 51 }, { 3, 3, 51 },
+	},
+	{ /* 85 */
+		{ 66, 1, 48 }, { 1, 3, 48 }, { 66, 1, 49 }, { 1, 3, 49 },
+		{ 66, 1, 50 }, { 1, 3, 50 }, { 66, 1, 97 }, { 1, 3, 97 },
+		{ 66, 1, 99 }, { 1, 3, 99 }, { 66, 1, 101 }, { 1, 3, 101 },
+		{ 66, 1, 105 }, { 1, 3, 105 }, { 66, 1, 111 }, { 1, 3, 111 },
+	},
+	{ /* 86 */
+		{ 85, 1, 48 }, { 67, 1, 48 }, { 93, 1, 48 }, { 2, 3, 48 },
+		{ 85, 1, 49 }, { 67, 1, 49 }, { 93, 1, 49 }, { 2, 3, 49 },
+		{ 85, 1, 50 }, { 67, 1, 50 }, { 93, 1, 50 }, { 2, 3, 50 },
+		{ 85, 1, 97 }, { 67, 1, 97 }, { 93, 1, 97 }, { 2, 3, 97 },
+	},
+	{ /* 87 */
+		{ 86, 1, 48 }, { 130, 1, 48 }, { 68, 1, 48 }, { 82, 1, 48 },
+		{ 99, 1, 48 }, { 94, 1, 48 }, { 104, 1, 48 }, { 3, 3, 48 },
+		{ 86, 1, 49 }, { 130, 1, 49 }, { 68, 1, 49 }, { 82, 1, 49 },
+		{ 99, 1, 49 }, { 94, 1, 49 }, { 104, 1, 49 }, { 3, 3, 49 },
+	},
+	{ /* 88 */
+		{ 86, 1, 50 }, { 130, 1, 50 }, { 68, 1, 50 }, { 82, 1, 50 },
+		{ 99, 1, 50 }, { 94, 1, 50 }, { 104, 1, 50 }, { 3, 3, 50 },
+		{ 86, 1, 97 }, { 130, 1, 97 }, { 68, 1, 97 }, { 82, 1, 97 },
+		{ 99, 1, 97 }, { 94, 1, 97 }, { 104, 1, 97 }, { 3, 3, 97 },
+	},
+	{ /* 89 */
+		{ 86, 1, 52 }, { 130, 1, 52 }, { 68, 1, 52 }, { 82, 1, 52 },
+		{ 99, 1, 52 }, { 94, 1, 52 }, { 104, 1, 52 }, { 3, 3, 52 },
+		{ 86, 1, 53 }, { 130, 1, 53 }, { 68, 1, 53 }, { 82, 1, 53 },
+		{ 99, 1, 53 }, { 94, 1, 53 }, { 104, 1, 53 }, { 3, 3, 53 },
+	},
+	{ /* 90 */
+		{ 85, 1, 54 }, { 67, 1, 54 }, { 93, 1, 54 }, { 2, 3, 54 },
+		{ 85, 1, 55 }, { 67, 1, 55 }, { 93, 1, 55 }, { 2, 3, 55 },
+		{ 85, 1, 56 }, { 67, 1, 56 }, { 93, 1, 56 }, { 2, 3, 56 },
+		{ 85, 1, 57 }, { 67, 1, 57 }, { 93, 1, 57 }, { 2, 3, 57 },
+	},
+	{ /* 91 */
+		{ 86, 1, 54 }, { 130, 1, 54 }, { 68, 1, 54 }, { 82, 1, 54 },
+		{ 99, 1, 54 }, { 94, 1, 54 }, { 104, 1, 54 }, { 3, 3, 54 },
+		{ 86, 1, 55 }, { 130, 1, 55 }, { 68, 1, 55 }, { 82, 1, 55 },
+		{ 99, 1, 55 }, { 94, 1, 55 }, { 104, 1, 55 }, { 3, 3, 55 },
+	},
+	{ /* 92 */
+		{ 86, 1, 56 }, { 130, 1, 56 }, { 68, 1, 56 }, { 82, 1, 56 },
+		{ 99, 1, 56 }, { 94, 1, 56 }, { 104, 1, 56 }, { 3, 3, 56 },
+		{ 86, 1, 57 }, { 130, 1, 57 }, { 68, 1, 57 }, { 82, 1, 57 },
+		{ 99, 1, 57 }, { 94, 1, 57 }, { 104, 1, 57 }, { 3, 3, 57 },
+	},
+	{ /* 93 */
+		{ 0, 3, 61 }, { 0, 3, 65 }, { 0, 3, 95 }, { 0, 3, 98 },
+		{ 0, 3, 100 }, { 0, 3, 102 }, { 0, 3, 103 }, { 0, 3, 104 },
+		{ 0, 3, 108 }, { 0, 3, 109 }, { 0, 3, 110 }, { 0, 3, 112 },
+		{ 0, 3, 114 }, { 0, 3, 117 }, { 97, 0, 0 }, { 103, 0, 0 },
+	},
+	{ /* 94 */
+		{ 66, 1, 108 }, { 1, 3, 108 }, { 66, 1, 109 }, { 1, 3, 109 },
+		{ 66, 1, 110 }, { 1, 3, 110 }, { 66, 1, 112 }, { 1, 3, 112 },
+		{ 66, 1, 114 }, { 1, 3, 114 }, { 66, 1, 117 }, { 1, 3, 117 },
+		{ 0, 3, 58 }, { 0, 3, 66 }, { 0, 3, 67 }, { 0, 3, 68 },
+	},
+	{ /* 95 */
+		{ 85, 1, 114 }, { 67, 1, 114 }, { 93, 1, 114 }, { 2, 3, 114 },
+		{ 85, 1, 117 }, { 67, 1, 117 }, { 93, 1, 117 }, { 2, 3, 117 },
+		{ 66, 1, 58 }, { 1, 3, 58 }, { 66, 1, 66 }, { 1, 3, 66 },
+		{ 66, 1, 67 }, { 1, 3, 67 }, { 66, 1, 68 }, { 1, 3, 68 },
+	},
+	{ /* 96 */
+		{ 85, 1, 58 }, { 67, 1, 58 }, { 93, 1, 58 }, { 2, 3, 58 },
+		{ 85, 1, 66 }, { 67, 1, 66 }, { 93, 1, 66 }, { 2, 3, 66 },
+		{ 85, 1, 67 }, { 67, 1, 67 }, { 93, 1, 67 }, { 2, 3, 67 },
+		{ 85, 1, 68 }, { 67, 1, 68 }, { 93, 1, 68 }, { 2, 3, 68 },
+	},
+	{ /* 97 */
+		{ 86, 1, 58 }, { 130, 1, 58 }, { 68, 1, 58 }, { 82, 1, 58 },
+		{ 99, 1, 58 }, { 94, 1, 58 }, { 104, 1, 58 }, { 3, 3, 58 },
+		{ 86, 1, 66 }, { 130, 1, 66 }, { 68, 1, 66 }, { 82, 1, 66 },
+		{ 99, 1, 66 }, { 94, 1, 66 }, { 104, 1, 66 }, { 3, 3, 66 },
+	},
+	{ /* 98 */
+		{ 86, 1, 60 }, { 130, 1, 60 }, { 68, 1, 60 }, { 82, 1, 60 },
+		{ 99, 1, 60 }, { 94, 1, 60 }, { 104, 1, 60 }, { 3, 3, 60 },
+		{ 86, 1, 96 }, { 130, 1, 96 }, { 68, 1, 96 }, { 82, 1, 96 },
+		{ 99, 1, 96 }, { 94, 1, 96 }, { 104, 1, 96 }, { 3, 3, 96 },
+	},
+	{ /* 99 */
+		{ 66, 1, 61 }, { 1, 3, 61 }, { 66, 1, 65 }, { 1, 3, 65 },
+		{ 66, 1, 95 }, { 1, 3, 95 }, { 66, 1, 98 }, { 1, 3, 98 },
+		{ 66, 1, 100 }, { 1, 3, 100 }, { 66, 1, 102 }, { 1, 3, 102 },
+		{ 66, 1, 103 }, { 1, 3, 103 }, { 66, 1, 104 }, { 1, 3, 104 },
+	},
+	{ /* 100 */
+		{ 85, 1, 61 }, { 67, 1, 61 }, { 93, 1, 61 }, { 2, 3, 61 },
+		{ 85, 1, 65 }, { 67, 1, 65 }, { 93, 1, 65 }, { 2, 3, 65 },
+		{ 85, 1, 95 }, { 67, 1, 95 }, { 93, 1, 95 }, { 2, 3, 95 },
+		{ 85, 1, 98 }, { 67, 1, 98 }, { 93, 1, 98 }, { 2, 3, 98 },
+	},
+	{ /* 101 */
+		{ 86, 1, 61 }, { 130, 1, 61 }, { 68, 1, 61 }, { 82, 1, 61 },
+		{ 99, 1, 61 }, { 94, 1, 61 }, { 104, 1, 61 }, { 3, 3, 61 },
+		{ 86, 1, 65 }, { 130, 1, 65 }, { 68, 1, 65 }, { 82, 1, 65 },
+		{ 99, 1, 65 }, { 94, 1, 65 }, { 104, 1, 65 }, { 3, 3, 65 },
+	},
+	{ /* 102 */
+		{ 86, 1, 64 }, { 130, 1, 64 }, { 68, 1, 64 }, { 82, 1, 64 },
+		{ 99, 1, 64 }, { 94, 1, 64 }, { 104, 1, 64 }, { 3, 3, 64 },
+		{ 86, 1, 91 }, { 130, 1, 91 }, { 68, 1, 91 }, { 82, 1, 91 },
+		{ 99, 1, 91 }, { 94, 1, 91 }, { 104, 1, 91 }, { 3, 3, 91 },
+	},
+	{ /* 103 */
+		{ 86, 1, 67 }, { 130, 1, 67 }, { 68, 1, 67 }, { 82, 1, 67 },
+		{ 99, 1, 67 }, { 94, 1, 67 }, { 104, 1, 67 }, { 3, 3, 67 },
+		{ 86, 1, 68 }, { 130, 1, 68 }, { 68, 1, 68 }, { 82, 1, 68 },
+		{ 99, 1, 68 }, { 94, 1, 68 }, { 104, 1, 68 }, { 3, 3, 68 },
+	},
+	{ /* 104 */
+		{ 0, 3, 69 }, { 0, 3, 70 }, { 0, 3, 71 }, { 0, 3, 72 },
+		{ 0, 3, 73 }, { 0, 3, 74 }, { 0, 3, 75 }, { 0, 3, 76 },
+		{ 0, 3, 77 }, { 0, 3, 78 }, { 0, 3, 79 }, { 0, 3, 80 },
+		{ 0, 3, 81 }, { 0, 3, 82 }, { 0, 3, 83 }, { 0, 3, 84 },
+	},
+	{ /* 105 */
+		{ 66, 1, 69 }, { 1, 3, 69 }, { 66, 1, 70 }, { 1, 3, 70 },
+		{ 66, 1, 71 }, { 1, 3, 71 }, { 66, 1, 72 }, { 1, 3, 72 },
+		{ 66, 1, 73 }, { 1, 3, 73 }, { 66, 1, 74 }, { 1, 3, 74 },
+		{ 66, 1, 75 }, { 1, 3, 75 }, { 66, 1, 76 }, { 1, 3, 76 },
+	},
+	{ /* 106 */
+		{ 85, 1, 69 }, { 67, 1, 69 }, { 93, 1, 69 }, { 2, 3, 69 },
+		{ 85, 1, 70 }, { 67, 1, 70 }, { 93, 1, 70 }, { 2, 3, 70 },
+		{ 85, 1, 71 }, { 67, 1, 71 }, { 93, 1, 71 }, { 2, 3, 71 },
+		{ 85, 1, 72 }, { 67, 1, 72 }, { 93, 1, 72 }, { 2, 3, 72 },
+	},
+	{ /* 107 */
+		{ 86, 1, 69 }, { 130, 1, 69 }, { 68, 1, 69 }, { 82, 1, 69 },
+		{ 99, 1, 69 }, { 94, 1, 69 }, { 104, 1, 69 }, { 3, 3, 69 },
+		{ 86, 1, 70 }, { 130, 1, 70 }, { 68, 1, 70 }, { 82, 1, 70 },
+		{ 99, 1, 70 }, { 94, 1, 70 }, { 104, 1, 70 }, { 3, 3, 70 },
+	},
+	{ /* 108 */
+		{ 86, 1, 71 }, { 130, 1, 71 }, { 68, 1, 71 }, { 82, 1, 71 },
+		{ 99, 1, 71 }, { 94, 1, 71 }, { 104, 1, 71 }, { 3, 3, 71 },
+		{ 86, 1, 72 }, { 130, 1, 72 }, { 68, 1, 72 }, { 82, 1, 72 },
+		{ 99, 1, 72 }, { 94, 1, 72 }, { 104, 1, 72 }, { 3, 3, 72 },
+	},
+	{ /* 109 */
+		{ 85, 1, 73 }, { 67, 1, 73 }, { 93, 1, 73 }, { 2, 3, 73 },
+		{ 85, 1, 74 }, { 67, 1, 74 }, { 93, 1, 74 }, { 2, 3, 74 },
+		{ 85, 1, 75 }, { 67, 1, 75 }, { 93, 1, 75 }, { 2, 3, 75 },
+		{ 85, 1, 76 }, { 67, 1, 76 }, { 93, 1, 76 }, { 2, 3, 76 },
+	},
+	{ /* 110 */
+		{ 86, 1, 73 }, { 130, 1, 73 }, { 68, 1, 73 }, { 82, 1, 73 },
+		{ 99, 1, 73 }, { 94, 1, 73 }, { 104, 1, 73 }, { 3, 3, 73 },
+		{ 86, 1, 74 }, { 130, 1, 74 }, { 68, 1, 74 }, { 82, 1, 74 },
+		{ 99, 1, 74 }, { 94, 1, 74 }, { 104, 1, 74 }, { 3, 3, 74 },
+	},
+	{ /* 111 */
+		{ 86, 1, 75 }, { 130, 1, 75 }, { 68, 1, 75 }, { 82, 1, 75 },
+		{ 99, 1, 75 }, { 94, 1, 75 }, { 104, 1, 75 }, { 3, 3, 75 },
+		{ 86, 1, 76 }, { 130, 1, 76 }, { 68, 1, 76 }, { 82, 1, 76 },
+		{ 99, 1, 76 }, { 94, 1, 76 }, { 104, 1, 76 }, { 3, 3, 76 },
+	},
+	{ /* 112 */
+		{ 66, 1, 77 }, { 1, 3, 77 }, { 66, 1, 78 }, { 1, 3, 78 },
+		{ 66, 1, 79 }, { 1, 3, 79 }, { 66, 1, 80 }, { 1, 3, 80 },
+		{ 66, 1, 81 }, { 1, 3, 81 }, { 66, 1, 82 }, { 1, 3, 82 },
+		{ 66, 1, 83 }, { 1, 3, 83 }, { 66, 1, 84 }, { 1, 3, 84 },
+	},
+	{ /* 113 */
+		{ 85, 1, 77 }, { 67, 1, 77 }, { 93, 1, 77 }, { 2, 3, 77 },
+		{ 85, 1, 78 }, { 67, 1, 78 }, { 93, 1, 78 }, { 2, 3, 78 },
+		{ 85, 1, 79 }, { 67, 1, 79 }, { 93, 1, 79 }, { 2, 3, 79 },
+		{ 85, 1, 80 }, { 67, 1, 80 }, { 93, 1, 80 }, { 2, 3, 80 },
+	},
+	{ /* 114 */
+		{ 86, 1, 77 }, { 130, 1, 77 }, { 68, 1, 77 }, { 82, 1, 77 },
+		{ 99, 1, 77 }, { 94, 1, 77 }, { 104, 1, 77 }, { 3, 3, 77 },
+		{ 86, 1, 78 }, { 130, 1, 78 }, { 68, 1, 78 }, { 82, 1, 78 },
+		{ 99, 1, 78 }, { 94, 1, 78 }, { 104, 1, 78 }, { 3, 3, 78 },
+	},
+	{ /* 115 */
+		{ 86, 1, 79 }, { 130, 1, 79 }, { 68, 1, 79 }, { 82, 1, 79 },
+		{ 99, 1, 79 }, { 94, 1, 79 }, { 104, 1, 79 }, { 3, 3, 79 },
+		{ 86, 1, 80 }, { 130, 1, 80 }, { 68, 1, 80 }, { 82, 1, 80 },
+		{ 99, 1, 80 }, { 94, 1, 80 }, { 104, 1, 80 }, { 3, 3, 80 },
+	},
+	{ /* 116 */
+		{ 85, 1, 81 }, { 67, 1, 81 }, { 93, 1, 81 }, { 2, 3, 81 },
+		{ 85, 1, 82 }, { 67, 1, 82 }, { 93, 1, 82 }, { 2, 3, 82 },
+		{ 85, 1, 83 }, { 67, 1, 83 }, { 93, 1, 83 }, { 2, 3, 83 },
+		{ 85, 1, 84 }, { 67, 1, 84 }, { 93, 1, 84 }, { 2, 3, 84 },
+	},
+	{ /* 117 */
+		{ 86, 1, 81 }, { 130, 1, 81 }, { 68, 1, 81 }, { 82, 1, 81 },
+		{ 99, 1, 81 }, { 94, 1, 81 }, { 104, 1, 81 }, { 3, 3, 81 },
+		{ 86, 1, 82 }, { 130, 1, 82 }, { 68, 1, 82 }, { 82, 1, 82 },
+		{ 99, 1, 82 }, { 94, 1, 82 }, { 104, 1, 82 }, { 3, 3, 82 },
+	},
+	{ /* 118 */
+		{ 86, 1, 83 }, { 130, 1, 83 }, { 68, 1, 83 }, { 82, 1, 83 },
+		{ 99, 1, 83 }, { 94, 1, 83 }, { 104, 1, 83 }, { 3, 3, 83 },
+		{ 86, 1, 84 }, { 130, 1, 84 }, { 68, 1, 84 }, { 82, 1, 84 },
+		{ 99, 1, 84 }, { 94, 1, 84 }, { 104, 1, 84 }, { 3, 3, 84 },
+	},
+	{ /* 119 */
+		{ 66, 1, 85 }, { 1, 3, 85 }, { 66, 1, 86 }, { 1, 3, 86 },
+		{ 66, 1, 87 }, { 1, 3, 87 }, { 66, 1, 89 }, { 1, 3, 89 },
+		{ 66, 1, 106 }, { 1, 3, 106 }, { 66, 1, 107 }, { 1, 3, 107 },
+		{ 66, 1, 113 }, { 1, 3, 113 }, { 66, 1, 118 }, { 1, 3, 118 },
+	},
+	{ /* 120 */
+		{ 85, 1, 85 }, { 67, 1, 85 }, { 93, 1, 85 }, { 2, 3, 85 },
+		{ 85, 1, 86 }, { 67, 1, 86 }, { 93, 1, 86 }, { 2, 3, 86 },
+		{ 85, 1, 87 }, { 67, 1, 87 }, { 93, 1, 87 }, { 2, 3, 87 },
+		{ 85, 1, 89 }, { 67, 1, 89 }, { 93, 1, 89 }, { 2, 3, 89 },
+	},
+	{ /* 121 */
+		{ 86, 1, 85 }, { 130, 1, 85 }, { 68, 1, 85 }, { 82, 1, 85 },
+		{ 99, 1, 85 }, { 94, 1, 85 }, { 104, 1, 85 }, { 3, 3, 85 },
+		{ 86, 1, 86 }, { 130, 1, 86 }, { 68, 1, 86 }, { 82, 1, 86 },
+		{ 99, 1, 86 }, { 94, 1, 86 }, { 104, 1, 86 }, { 3, 3, 86 },
+	},
+	{ /* 122 */
+		{ 86, 1, 87 }, { 130, 1, 87 }, { 68, 1, 87 }, { 82, 1, 87 },
+		{ 99, 1, 87 }, { 94, 1, 87 }, { 104, 1, 87 }, { 3, 3, 87 },
+		{ 86, 1, 89 }, { 130, 1, 89 }, { 68, 1, 89 }, { 82, 1, 89 },
+		{ 99, 1, 89 }, { 94, 1, 89 }, { 104, 1, 89 }, { 3, 3, 89 },
+	},
+	{ /* 123 */
+		{ 86, 1, 88 }, { 130, 1, 88 }, { 68, 1, 88 }, { 82, 1, 88 },
+		{ 99, 1, 88 }, { 94, 1, 88 }, { 104, 1, 88 }, { 3, 3, 88 },
+		{ 86, 1, 90 }, { 130, 1, 90 }, { 68, 1, 90 }, { 82, 1, 90 },
+		{ 99, 1, 90 }, { 94, 1, 90 }, { 104, 1, 90 }, { 3, 3, 90 },
+	},
+	{ /* 124 */
+		{ 66, 1, 92 }, { 1, 3, 92 }, { 66, 1, 195 }, { 1, 3, 195 },
+		{ 66, 1, 208 }, { 1, 3, 208 }, { 0, 3, 128 }, { 0, 3, 130 },
+		{ 0, 3, 131 }, { 0, 3, 162 }, { 0, 3, 184 }, { 0, 3, 194 },
+		{ 0, 3, 224 }, { 0, 3, 226 }, { 177, 0, 0 }, { 188, 0, 0 },
+	},
+	{ /* 125 */
+		{ 85, 1, 92 }, { 67, 1, 92 }, { 93, 1, 92 }, { 2, 3, 92 },
+		{ 85, 1, 195 }, { 67, 1, 195 }, { 93, 1, 195 }, { 2, 3, 195 },
+		{ 85, 1, 208 }, { 67, 1, 208 }, { 93, 1, 208 }, { 2, 3, 208 },
+		{ 66, 1, 128 }, { 1, 3, 128 }, { 66, 1, 130 }, { 1, 3, 130 },
+	},
+	{ /* 126 */
+		{ 86, 1, 92 }, { 130, 1, 92 }, { 68, 1, 92 }, { 82, 1, 92 },
+		{ 99, 1, 92 }, { 94, 1, 92 }, { 104, 1, 92 }, { 3, 3, 92 },
+		{ 86, 1, 195 }, { 130, 1, 195 }, { 68, 1, 195 }, { 82, 1, 195 },
+		{ 99, 1, 195 }, { 94, 1, 195 }, { 104, 1, 195 }, { 3, 3, 195 },
+	},
+	{ /* 127 */
+		{ 86, 1, 93 }, { 130, 1, 93 }, { 68, 1, 93 }, { 82, 1, 93 },
+		{ 99, 1, 93 }, { 94, 1, 93 }, { 104, 1, 93 }, { 3, 3, 93 },
+		{ 86, 1, 126 }, { 130, 1, 126 }, { 68, 1, 126 }, { 82, 1, 126 },
+		{ 99, 1, 126 }, { 94, 1, 126 }, { 104, 1, 126 }, { 3, 3, 126 },
+	},
+	{ /* 128 */
+		{ 86, 1, 94 }, { 130, 1, 94 }, { 68, 1, 94 }, { 82, 1, 94 },
+		{ 99, 1, 94 }, { 94, 1, 94 }, { 104, 1, 94 }, { 3, 3, 94 },
+		{ 86, 1, 125 }, { 130, 1, 125 }, { 68, 1, 125 }, { 82, 1, 125 },
+		{ 99, 1, 125 }, { 94, 1, 125 }, { 104, 1, 125 }, { 3, 3, 125 },
+	},
+	{ /* 129 */
+		{ 86, 1, 95 }, { 130, 1, 95 }, { 68, 1, 95 }, { 82, 1, 95 },
+		{ 99, 1, 95 }, { 94, 1, 95 }, { 104, 1, 95 }, { 3, 3, 95 },
+		{ 86, 1, 98 }, { 130, 1, 98 }, { 68, 1, 98 }, { 82, 1, 98 },
+		{ 99, 1, 98 }, { 94, 1, 98 }, { 104, 1, 98 }, { 3, 3, 98 },
+	},
+	{ /* 130 */
+		{ 85, 1, 99 }, { 67, 1, 99 }, { 93, 1, 99 }, { 2, 3, 99 },
+		{ 85, 1, 101 }, { 67, 1, 101 }, { 93, 1, 101 }, { 2, 3, 101 },
+		{ 85, 1, 105 }, { 67, 1, 105 }, { 93, 1, 105 }, { 2, 3, 105 },
+		{ 85, 1, 111 }, { 67, 1, 111 }, { 93, 1, 111 }, { 2, 3, 111 },
+	},
+	{ /* 131 */
+		{ 86, 1, 99 }, { 130, 1, 99 }, { 68, 1, 99 }, { 82, 1, 99 },
+		{ 99, 1, 99 }, { 94, 1, 99 }, { 104, 1, 99 }, { 3, 3, 99 },
+		{ 86, 1, 101 }, { 130, 1, 101 }, { 68, 1, 101 }, { 82, 1, 101 },
+		{ 99, 1, 101 }, { 94, 1, 101 }, { 104, 1, 101 }, { 3, 3, 101 },
+	},
+	{ /* 132 */
+		{ 85, 1, 100 }, { 67, 1, 100 }, { 93, 1, 100 }, { 2, 3, 100 },
+		{ 85, 1, 102 }, { 67, 1, 102 }, { 93, 1, 102 }, { 2, 3, 102 },
+		{ 85, 1, 103 }, { 67, 1, 103 }, { 93, 1, 103 }, { 2, 3, 103 },
+		{ 85, 1, 104 }, { 67, 1, 104 }, { 93, 1, 104 }, { 2, 3, 104 },
+	},
+	{ /* 133 */
+		{ 86, 1, 100 }, { 130, 1, 100 }, { 68, 1, 100 }, { 82, 1, 100 },
+		{ 99, 1, 100 }, { 94, 1, 100 }, { 104, 1, 100 }, { 3, 3, 100 },
+		{ 86, 1, 102 }, { 130, 1, 102 }, { 68, 1, 102 }, { 82, 1, 102 },
+		{ 99, 1, 102 }, { 94, 1, 102 }, { 104, 1, 102 }, { 3, 3, 102 },
+	},
+	{ /* 134 */
+		{ 86, 1, 103 }, { 130, 1, 103 }, { 68, 1, 103 }, { 82, 1, 103 },
+		{ 99, 1, 103 }, { 94, 1, 103 }, { 104, 1, 103 }, { 3, 3, 103 },
+		{ 86, 1, 104 }, { 130, 1, 104 }, { 68, 1, 104 }, { 82, 1, 104 },
+		{ 99, 1, 104 }, { 94, 1, 104 }, { 104, 1, 104 }, { 3, 3, 104 },
+	},
+	{ /* 135 */
+		{ 86, 1, 105 }, { 130, 1, 105 }, { 68, 1, 105 }, { 82, 1, 105 },
+		{ 99, 1, 105 }, { 94, 1, 105 }, { 104, 1, 105 }, { 3, 3, 105 },
+		{ 86, 1, 111 }, { 130, 1, 111 }, { 68, 1, 111 }, { 82, 1, 111 },
+		{ 99, 1, 111 }, { 94, 1, 111 }, { 104, 1, 111 }, { 3, 3, 111 },
+	},
+	{ /* 136 */
+		{ 85, 1, 106 }, { 67, 1, 106 }, { 93, 1, 106 }, { 2, 3, 106 },
+		{ 85, 1, 107 }, { 67, 1, 107 }, { 93, 1, 107 }, { 2, 3, 107 },
+		{ 85, 1, 113 }, { 67, 1, 113 }, { 93, 1, 113 }, { 2, 3, 113 },
+		{ 85, 1, 118 }, { 67, 1, 118 }, { 93, 1, 118 }, { 2, 3, 118 },
+	},
+	{ /* 137 */
+		{ 86, 1, 106 }, { 130, 1, 106 }, { 68, 1, 106 }, { 82, 1, 106 },
+		{ 99, 1, 106 }, { 94, 1, 106 }, { 104, 1, 106 }, { 3, 3, 106 },
+		{ 86, 1, 107 }, { 130, 1, 107 }, { 68, 1, 107 }, { 82, 1, 107 },
+		{ 99, 1, 107 }, { 94, 1, 107 }, { 104, 1, 107 }, { 3, 3, 107 },
+	},
+	{ /* 138 */
+		{ 85, 1, 108 }, { 67, 1, 108 }, { 93, 1, 108 }, { 2, 3, 108 },
+		{ 85, 1, 109 }, { 67, 1, 109 }, { 93, 1, 109 }, { 2, 3, 109 },
+		{ 85, 1, 110 }, { 67, 1, 110 }, { 93, 1, 110 }, { 2, 3, 110 },
+		{ 85, 1, 112 }, { 67, 1, 112 }, { 93, 1, 112 }, { 2, 3, 112 },
+	},
+	{ /* 139 */
+		{ 86, 1, 108 }, { 130, 1, 108 }, { 68, 1, 108 }, { 82, 1, 108 },
+		{ 99, 1, 108 }, { 94, 1, 108 }, { 104, 1, 108 }, { 3, 3, 108 },
+		{ 86, 1, 109 }, { 130, 1, 109 }, { 68, 1, 109 }, { 82, 1, 109 },
+		{ 99, 1, 109 }, { 94, 1, 109 }, { 104, 1, 109 }, { 3, 3, 109 },
+	},
+	{ /* 140 */
+		{ 86, 1, 110 }, { 130, 1, 110 }, { 68, 1, 110 }, { 82, 1, 110 },
+		{ 99, 1, 110 }, { 94, 1, 110 }, { 104, 1, 110 }, { 3, 3, 110 },
+		{ 86, 1, 112 }, { 130, 1, 112 }, { 68, 1, 112 }, { 82, 1, 112 },
+		{ 99, 1, 112 }, { 94, 1, 112 }, { 104, 1, 112 }, { 3, 3, 112 },
+	},
+	{ /* 141 */
+		{ 86, 1, 113 }, { 130, 1, 113 }, { 68, 1, 113 }, { 82, 1, 113 },
+		{ 99, 1, 113 }, { 94, 1, 113 }, { 104, 1, 113 }, { 3, 3, 113 },
+		{ 86, 1, 118 }, { 130, 1, 118 }, { 68, 1, 118 }, { 82, 1, 118 },
+		{ 99, 1, 118 }, { 94, 1, 118 }, { 104, 1, 118 }, { 3, 3, 118 },
+	},
+	{ /* 142 */
+		{ 86, 1, 114 }, { 130, 1, 114 }, { 68, 1, 114 }, { 82, 1, 114 },
+		{ 99, 1, 114 }, { 94, 1, 114 }, { 104, 1, 114 }, { 3, 3, 114 },
+		{ 86, 1, 117 }, { 130, 1, 117 }, { 68, 1, 117 }, { 82, 1, 117 },
+		{ 99, 1, 117 }, { 94, 1, 117 }, { 104, 1, 117 }, { 3, 3, 117 },
+	},
+	{ /* 143 */
+		{ 86, 1, 115 }, { 130, 1, 115 }, { 68, 1, 115 }, { 82, 1, 115 },
+		{ 99, 1, 115 }, { 94, 1, 115 }, { 104, 1, 115 }, { 3, 3, 115 },
+		{ 86, 1, 116 }, { 130, 1, 116 }, { 68, 1, 116 }, { 82, 1, 116 },
+		{ 99, 1, 116 }, { 94, 1, 116 }, { 104, 1, 116 }, { 3, 3, 116 },
+	},
+	{ /* 144 */
+		{ 85, 1, 119 }, { 67, 1, 119 }, { 93, 1, 119 }, { 2, 3, 119 },
+		{ 85, 1, 120 }, { 67, 1, 120 }, { 93, 1, 120 }, { 2, 3, 120 },
+		{ 85, 1, 121 }, { 67, 1, 121 }, { 93, 1, 121 }, { 2, 3, 121 },
+		{ 85, 1, 122 }, { 67, 1, 122 }, { 93, 1, 122 }, { 2, 3, 122 },
+	},
+	{ /* 145 */
+		{ 86, 1, 119 }, { 130, 1, 119 }, { 68, 1, 119 }, { 82, 1, 119 },
+		{ 99, 1, 119 }, { 94, 1, 119 }, { 104, 1, 119 }, { 3, 3, 119 },
+		{ 86, 1, 120 }, { 130, 1, 120 }, { 68, 1, 120 }, { 82, 1, 120 },
+		{ 99, 1, 120 }, { 94, 1, 120 }, { 104, 1, 120 }, { 3, 3, 120 },
+	},
+	{ /* 146 */
+		{ 86, 1, 121 }, { 130, 1, 121 }, { 68, 1, 121 }, { 82, 1, 121 },
+		{ 99, 1, 121 }, { 94, 1, 121 }, { 104, 1, 121 }, { 3, 3, 121 },
+		{ 86, 1, 122 }, { 130, 1, 122 }, { 68, 1, 122 }, { 82, 1, 122 },
+		{ 99, 1, 122 }, { 94, 1, 122 }, { 104, 1, 122 }, { 3, 3, 122 },
+	},
+	{ /* 147 */
+		{ 86, 1, 127 }, { 130, 1, 127 }, { 68, 1, 127 }, { 82, 1, 127 },
+		{ 99, 1, 127 }, { 94, 1, 127 }, { 104, 1, 127 }, { 3, 3, 127 },
+		{ 86, 1, 220 }, { 130, 1, 220 }, { 68, 1, 220 }, { 82, 1, 220 },
+		{ 99, 1, 220 }, { 94, 1, 220 }, { 104, 1, 220 }, { 3, 3, 220 },
+	},
+	{ /* 148 */
+		{ 86, 1, 208 }, { 130, 1, 208 }, { 68, 1, 208 }, { 82, 1, 208 },
+		{ 99, 1, 208 }, { 94, 1, 208 }, { 104, 1, 208 }, { 3, 3, 208 },
+		{ 85, 1, 128 }, { 67, 1, 128 }, { 93, 1, 128 }, { 2, 3, 128 },
+		{ 85, 1, 130 }, { 67, 1, 130 }, { 93, 1, 130 }, { 2, 3, 130 },
+	},
+	{ /* 149 */
+		{ 86, 1, 128 }, { 130, 1, 128 }, { 68, 1, 128 }, { 82, 1, 128 },
+		{ 99, 1, 128 }, { 94, 1, 128 }, { 104, 1, 128 }, { 3, 3, 128 },
+		{ 86, 1, 130 }, { 130, 1, 130 }, { 68, 1, 130 }, { 82, 1, 130 },
+		{ 99, 1, 130 }, { 94, 1, 130 }, { 104, 1, 130 }, { 3, 3, 130 },
+	},
+	{ /* 150 */
+		{ 0, 3, 176 }, { 0, 3, 177 }, { 0, 3, 179 }, { 0, 3, 209 },
+		{ 0, 3, 216 }, { 0, 3, 217 }, { 0, 3, 227 }, { 0, 3, 229 },
+		{ 0, 3, 230 }, { 154, 0, 0 }, { 159, 0, 0 }, { 160, 0, 0 },
+		{ 180, 0, 0 }, { 182, 0, 0 }, { 184, 0, 0 }, { 190, 0, 0 },
+	},
+	{ /* 151 */
+		{ 66, 1, 230 }, { 1, 3, 230 }, { 0, 3, 129 }, { 0, 3, 132 },
+		{ 0, 3, 133 }, { 0, 3, 134 }, { 0, 3, 136 }, { 0, 3, 146 },
+		{ 0, 3, 154 }, { 0, 3, 156 }, { 0, 3, 160 }, { 0, 3, 163 },
+		{ 0, 3, 164 }, { 0, 3, 169 }, { 0, 3, 170 }, { 0, 3, 173 },
+	},
+	{ /* 152 */
+		{ 85, 1, 230 }, { 67, 1, 230 }, { 93, 1, 230 }, { 2, 3, 230 },
+		{ 66, 1, 129 }, { 1, 3, 129 }, { 66, 1, 132 }, { 1, 3, 132 },
+		{ 66, 1, 133 }, { 1, 3, 133 }, { 66, 1, 134 }, { 1, 3, 134 },
+		{ 66, 1, 136 }, { 1, 3, 136 }, { 66, 1, 146 }, { 1, 3, 146 },
+	},
+	{ /* 153 */
+		{ 86, 1, 230 }, { 130, 1, 230 }, { 68, 1, 230 }, { 82, 1, 230 },
+		{ 99, 1, 230 }, { 94, 1, 230 }, { 104, 1, 230 }, { 3, 3, 230 },
+		{ 85, 1, 129 }, { 67, 1, 129 }, { 93, 1, 129 }, { 2, 3, 129 },
+		{ 85, 1, 132 }, { 67, 1, 132 }, { 93, 1, 132 }, { 2, 3, 132 },
+	},
+	{ /* 154 */
+		{ 86, 1, 129 }, { 130, 1, 129 }, { 68, 1, 129 }, { 82, 1, 129 },
+		{ 99, 1, 129 }, { 94, 1, 129 }, { 104, 1, 129 }, { 3, 3, 129 },
+		{ 86, 1, 132 }, { 130, 1, 132 }, { 68, 1, 132 }, { 82, 1, 132 },
+		{ 99, 1, 132 }, { 94, 1, 132 }, { 104, 1, 132 }, { 3, 3, 132 },
+	},
+	{ /* 155 */
+		{ 66, 1, 131 }, { 1, 3, 131 }, { 66, 1, 162 }, { 1, 3, 162 },
+		{ 66, 1, 184 }, { 1, 3, 184 }, { 66, 1, 194 }, { 1, 3, 194 },
+		{ 66, 1, 224 }, { 1, 3, 224 }, { 66, 1, 226 }, { 1, 3, 226 },
+		{ 0, 3, 153 }, { 0, 3, 161 }, { 0, 3, 167 }, { 0, 3, 172 },
+	},
+	{ /* 156 */
+		{ 85, 1, 131 }, { 67, 1, 131 }, { 93, 1, 131 }, { 2, 3, 131 },
+		{ 85, 1, 162 }, { 67, 1, 162 }, { 93, 1, 162 }, { 2, 3, 162 },
+		{ 85, 1, 184 }, { 67, 1, 184 }, { 93, 1, 184 }, { 2, 3, 184 },
+		{ 85, 1, 194 }, { 67, 1, 194 }, { 93, 1, 194 }, { 2, 3, 194 },
+	},
+	{ /* 157 */
+		{ 86, 1, 131 }, { 130, 1, 131 }, { 68, 1, 131 }, { 82, 1, 131 },
+		{ 99, 1, 131 }, { 94, 1, 131 }, { 104, 1, 131 }, { 3, 3, 131 },
+		{ 86, 1, 162 }, { 130, 1, 162 }, { 68, 1, 162 }, { 82, 1, 162 },
+		{ 99, 1, 162 }, { 94, 1, 162 }, { 104, 1, 162 }, { 3, 3, 162 },
+	},
+	{ /* 158 */
+		{ 85, 1, 133 }, { 67, 1, 133 }, { 93, 1, 133 }, { 2, 3, 133 },
+		{ 85, 1, 134 }, { 67, 1, 134 }, { 93, 1, 134 }, { 2, 3, 134 },
+		{ 85, 1, 136 }, { 67, 1, 136 }, { 93, 1, 136 }, { 2, 3, 136 },
+		{ 85, 1, 146 }, { 67, 1, 146 }, { 93, 1, 146 }, { 2, 3, 146 },
+	},
+	{ /* 159 */
+		{ 86, 1, 133 }, { 130, 1, 133 }, { 68, 1, 133 }, { 82, 1, 133 },
+		{ 99, 1, 133 }, { 94, 1, 133 }, { 104, 1, 133 }, { 3, 3, 133 },
+		{ 86, 1, 134 }, { 130, 1, 134 }, { 68, 1, 134 }, { 82, 1, 134 },
+		{ 99, 1, 134 }, { 94, 1, 134 }, { 104, 1, 134 }, { 3, 3, 134 },
+	},
+	{ /* 160 */
+		{ 86, 1, 136 }, { 130, 1, 136 }, { 68, 1, 136 }, { 82, 1, 136 },
+		{ 99, 1, 136 }, { 94, 1, 136 }, { 104, 1, 136 }, { 3, 3, 136 },
+		{ 86, 1, 146 }, { 130, 1, 146 }, { 68, 1, 146 }, { 82, 1, 146 },
+		{ 99, 1, 146 }, { 94, 1, 146 }, { 104, 1, 146 }, { 3, 3, 146 },
+	},
+	{ /* 161 */
+		{ 86, 1, 137 }, { 130, 1, 137 }, { 68, 1, 137 }, { 82, 1, 137 },
+		{ 99, 1, 137 }, { 94, 1, 137 }, { 104, 1, 137 }, { 3, 3, 137 },
+		{ 86, 1, 138 }, { 130, 1, 138 }, { 68, 1, 138 }, { 82, 1, 138 },
+		{ 99, 1, 138 }, { 94, 1, 138 }, { 104, 1, 138 }, { 3, 3, 138 },
+	},
+	{ /* 162 */
+		{ 85, 1, 139 }, { 67, 1, 139 }, { 93, 1, 139 }, { 2, 3, 139 },
+		{ 85, 1, 140 }, { 67, 1, 140 }, { 93, 1, 140 }, { 2, 3, 140 },
+		{ 85, 1, 141 }, { 67, 1, 141 }, { 93, 1, 141 }, { 2, 3, 141 },
+		{ 85, 1, 143 }, { 67, 1, 143 }, { 93, 1, 143 }, { 2, 3, 143 },
+	},
+	{ /* 163 */
+		{ 86, 1, 139 }, { 130, 1, 139 }, { 68, 1, 139 }, { 82, 1, 139 },
+		{ 99, 1, 139 }, { 94, 1, 139 }, { 104, 1, 139 }, { 3, 3, 139 },
+		{ 86, 1, 140 }, { 130, 1, 140 }, { 68, 1, 140 }, { 82, 1, 140 },
+		{ 99, 1, 140 }, { 94, 1, 140 }, { 104, 1, 140 }, { 3, 3, 140 },
+	},
+	{ /* 164 */
+		{ 86, 1, 141 }, { 130, 1, 141 }, { 68, 1, 141 }, { 82, 1, 141 },
+		{ 99, 1, 141 }, { 94, 1, 141 }, { 104, 1, 141 }, { 3, 3, 141 },
+		{ 86, 1, 143 }, { 130, 1, 143 }, { 68, 1, 143 }, { 82, 1, 143 },
+		{ 99, 1, 143 }, { 94, 1, 143 }, { 104, 1, 143 }, { 3, 3, 143 },
+	},
+	{ /* 165 */
+		{ 85, 1, 144 }, { 67, 1, 144 }, { 93, 1, 144 }, { 2, 3, 144 },
+		{ 85, 1, 145 }, { 67, 1, 145 }, { 93, 1, 145 }, { 2, 3, 145 },
+		{ 85, 1, 148 }, { 67, 1, 148 }, { 93, 1, 148 }, { 2, 3, 148 },
+		{ 85, 1, 159 }, { 67, 1, 159 }, { 93, 1, 159 }, { 2, 3, 159 },
+	},
+	{ /* 166 */
+		{ 86, 1, 144 }, { 130, 1, 144 }, { 68, 1, 144 }, { 82, 1, 144 },
+		{ 99, 1, 144 }, { 94, 1, 144 }, { 104, 1, 144 }, { 3, 3, 144 },
+		{ 86, 1, 145 }, { 130, 1, 145 }, { 68, 1, 145 }, { 82, 1, 145 },
+		{ 99, 1, 145 }, { 94, 1, 145 }, { 104, 1, 145 }, { 3, 3, 145 },
+	},
+	{ /* 167 */
+		{ 0, 3, 147 }, { 0, 3, 149 }, { 0, 3, 150 }, { 0, 3, 151 },
+		{ 0, 3, 152 }, { 0, 3, 155 }, { 0, 3, 157 }, { 0, 3, 158 },
+		{ 0, 3, 165 }, { 0, 3, 166 }, { 0, 3, 168 }, { 0, 3, 174 },
+		{ 0, 3, 175 }, { 0, 3, 180 }, { 0, 3, 182 }, { 0, 3, 183 },
+	},
+	{ /* 168 */
+		{ 66, 1, 147 }, { 1, 3, 147 }, { 66, 1, 149 }, { 1, 3, 149 },
+		{ 66, 1, 150 }, { 1, 3, 150 }, { 66, 1, 151 }, { 1, 3, 151 },
+		{ 66, 1, 152 }, { 1, 3, 152 }, { 66, 1, 155 }, { 1, 3, 155 },
+		{ 66, 1, 157 }, { 1, 3, 157 }, { 66, 1, 158 }, { 1, 3, 158 },
+	},
+	{ /* 169 */
+		{ 85, 1, 147 }, { 67, 1, 147 }, { 93, 1, 147 }, { 2, 3, 147 },
+		{ 85, 1, 149 }, { 67, 1, 149 }, { 93, 1, 149 }, { 2, 3, 149 },
+		{ 85, 1, 150 }, { 67, 1, 150 }, { 93, 1, 150 }, { 2, 3, 150 },
+		{ 85, 1, 151 }, { 67, 1, 151 }, { 93, 1, 151 }, { 2, 3, 151 },
+	},
+	{ /* 170 */
+		{ 86, 1, 147 }, { 130, 1, 147 }, { 68, 1, 147 }, { 82, 1, 147 },
+		{ 99, 1, 147 }, { 94, 1, 147 }, { 104, 1, 147 }, { 3, 3, 147 },
+		{ 86, 1, 149 }, { 130, 1, 149 }, { 68, 1, 149 }, { 82, 1, 149 },
+		{ 99, 1, 149 }, { 94, 1, 149 }, { 104, 1, 149 }, { 3, 3, 149 },
+	},
+	{ /* 171 */
+		{ 86, 1, 148 }, { 130, 1, 148 }, { 68, 1, 148 }, { 82, 1, 148 },
+		{ 99, 1, 148 }, { 94, 1, 148 }, { 104, 1, 148 }, { 3, 3, 148 },
+		{ 86, 1, 159 }, { 130, 1, 159 }, { 68, 1, 159 }, { 82, 1, 159 },
+		{ 99, 1, 159 }, { 94, 1, 159 }, { 104, 1, 159 }, { 3, 3, 159 },
+	},
+	{ /* 172 */
+		{ 86, 1, 150 }, { 130, 1, 150 }, { 68, 1, 150 }, { 82, 1, 150 },
+		{ 99, 1, 150 }, { 94, 1, 150 }, { 104, 1, 150 }, { 3, 3, 150 },
+		{ 86, 1, 151 }, { 130, 1, 151 }, { 68, 1, 151 }, { 82, 1, 151 },
+		{ 99, 1, 151 }, { 94, 1, 151 }, { 104, 1, 151 }, { 3, 3, 151 },
+	},
+	{ /* 173 */
+		{ 85, 1, 152 }, { 67, 1, 152 }, { 93, 1, 152 }, { 2, 3, 152 },
+		{ 85, 1, 155 }, { 67, 1, 155 }, { 93, 1, 155 }, { 2, 3, 155 },
+		{ 85, 1, 157 }, { 67, 1, 157 }, { 93, 1, 157 }, { 2, 3, 157 },
+		{ 85, 1, 158 }, { 67, 1, 158 }, { 93, 1, 158 }, { 2, 3, 158 },
+	},
+	{ /* 174 */
+		{ 86, 1, 152 }, { 130, 1, 152 }, { 68, 1, 152 }, { 82, 1, 152 },
+		{ 99, 1, 152 }, { 94, 1, 152 }, { 104, 1, 152 }, { 3, 3, 152 },
+		{ 86, 1, 155 }, { 130, 1, 155 }, { 68, 1, 155 }, { 82, 1, 155 },
+		{ 99, 1, 155 }, { 94, 1, 155 }, { 104, 1, 155 }, { 3, 3, 155 },
+	},
+	{ /* 175 */
+		{ 85, 1, 224 }, { 67, 1, 224 }, { 93, 1, 224 }, { 2, 3, 224 },
+		{ 85, 1, 226 }, { 67, 1, 226 }, { 93, 1, 226 }, { 2, 3, 226 },
+		{ 66, 1, 153 }, { 1, 3, 153 }, { 66, 1, 161 }, { 1, 3, 161 },
+		{ 66, 1, 167 }, { 1, 3, 167 }, { 66, 1, 172 }, { 1, 3, 172 },
+	},
+	{ /* 176 */
+		{ 85, 1, 153 }, { 67, 1, 153 }, { 93, 1, 153 }, { 2, 3, 153 },
+		{ 85, 1, 161 }, { 67, 1, 161 }, { 93, 1, 161 }, { 2, 3, 161 },
+		{ 85, 1, 167 }, { 67, 1, 167 }, { 93, 1, 167 }, { 2, 3, 167 },
+		{ 85, 1, 172 }, { 67, 1, 172 }, { 93, 1, 172 }, { 2, 3, 172 },
+	},
+	{ /* 177 */
+		{ 86, 1, 153 }, { 130, 1, 153 }, { 68, 1, 153 }, { 82, 1, 153 },
+		{ 99, 1, 153 }, { 94, 1, 153 }, { 104, 1, 153 }, { 3, 3, 153 },
+		{ 86, 1, 161 }, { 130, 1, 161 }, { 68, 1, 161 }, { 82, 1, 161 },
+		{ 99, 1, 161 }, { 94, 1, 161 }, { 104, 1, 161 }, { 3, 3, 161 },
+	},
+	{ /* 178 */
+		{ 66, 1, 154 }, { 1, 3, 154 }, { 66, 1, 156 }, { 1, 3, 156 },
+		{ 66, 1, 160 }, { 1, 3, 160 }, { 66, 1, 163 }, { 1, 3, 163 },
+		{ 66, 1, 164 }, { 1, 3, 164 }, { 66, 1, 169 }, { 1, 3, 169 },
+		{ 66, 1, 170 }, { 1, 3, 170 }, { 66, 1, 173 }, { 1, 3, 173 },
+	},
+	{ /* 179 */
+		{ 85, 1, 154 }, { 67, 1, 154 }, { 93, 1, 154 }, { 2, 3, 154 },
+		{ 85, 1, 156 }, { 67, 1, 156 }, { 93, 1, 156 }, { 2, 3, 156 },
+		{ 85, 1, 160 }, { 67, 1, 160 }, { 93, 1, 160 }, { 2, 3, 160 },
+		{ 85, 1, 163 }, { 67, 1, 163 }, { 93, 1, 163 }, { 2, 3, 163 },
+	},
+	{ /* 180 */
+		{ 86, 1, 154 }, { 130, 1, 154 }, { 68, 1, 154 }, { 82, 1, 154 },
+		{ 99, 1, 154 }, { 94, 1, 154 }, { 104, 1, 154 }, { 3, 3, 154 },
+		{ 86, 1, 156 }, { 130, 1, 156 }, { 68, 1, 156 }, { 82, 1, 156 },
+		{ 99, 1, 156 }, { 94, 1, 156 }, { 104, 1, 156 }, { 3, 3, 156 },
+	},
+	{ /* 181 */
+		{ 86, 1, 157 }, { 130, 1, 157 }, { 68, 1, 157 }, { 82, 1, 157 },
+		{ 99, 1, 157 }, { 94, 1, 157 }, { 104, 1, 157 }, { 3, 3, 157 },
+		{ 86, 1, 158 }, { 130, 1, 158 }, { 68, 1, 158 }, { 82, 1, 158 },
+		{ 99, 1, 158 }, { 94, 1, 158 }, { 104, 1, 158 }, { 3, 3, 158 },
+	},
+	{ /* 182 */
+		{ 86, 1, 160 }, { 130, 1, 160 }, { 68, 1, 160 }, { 82, 1, 160 },
+		{ 99, 1, 160 }, { 94, 1, 160 }, { 104, 1, 160 }, { 3, 3, 160 },
+		{ 86, 1, 163 }, { 130, 1, 163 }, { 68, 1, 163 }, { 82, 1, 163 },
+		{ 99, 1, 163 }, { 94, 1, 163 }, { 104, 1, 163 }, { 3, 3, 163 },
+	},
+	{ /* 183 */
+		{ 85, 1, 164 }, { 67, 1, 164 }, { 93, 1, 164 }, { 2, 3, 164 },
+		{ 85, 1, 169 }, { 67, 1, 169 }, { 93, 1, 169 }, { 2, 3, 169 },
+		{ 85, 1, 170 }, { 67, 1, 170 }, { 93, 1, 170 }, { 2, 3, 170 },
+		{ 85, 1, 173 }, { 67, 1, 173 }, { 93, 1, 173 }, { 2, 3, 173 },
+	},
+	{ /* 184 */
+		{ 86, 1, 164 }, { 130, 1, 164 }, { 68, 1, 164 }, { 82, 1, 164 },
+		{ 99, 1, 164 }, { 94, 1, 164 }, { 104, 1, 164 }, { 3, 3, 164 },
+		{ 86, 1, 169 }, { 130, 1, 169 }, { 68, 1, 169 }, { 82, 1, 169 },
+		{ 99, 1, 169 }, { 94, 1, 169 }, { 104, 1, 169 }, { 3, 3, 169 },
+	},
+	{ /* 185 */
+		{ 66, 1, 165 }, { 1, 3, 165 }, { 66, 1, 166 }, { 1, 3, 166 },
+		{ 66, 1, 168 }, { 1, 3, 168 }, { 66, 1, 174 }, { 1, 3, 174 },
+		{ 66, 1, 175 }, { 1, 3, 175 }, { 66, 1, 180 }, { 1, 3, 180 },
+		{ 66, 1, 182 }, { 1, 3, 182 }, { 66, 1, 183 }, { 1, 3, 183 },
+	},
+	{ /* 186 */
+		{ 85, 1, 165 }, { 67, 1, 165 }, { 93, 1, 165 }, { 2, 3, 165 },
+		{ 85, 1, 166 }, { 67, 1, 166 }, { 93, 1, 166 }, { 2, 3, 166 },
+		{ 85, 1, 168 }, { 67, 1, 168 }, { 93, 1, 168 }, { 2, 3, 168 },
+		{ 85, 1, 174 }, { 67, 1, 174 }, { 93, 1, 174 }, { 2, 3, 174 },
+	},
+	{ /* 187 */
+		{ 86, 1, 165 }, { 130, 1, 165 }, { 68, 1, 165 }, { 82, 1, 165 },
+		{ 99, 1, 165 }, { 94, 1, 165 }, { 104, 1, 165 }, { 3, 3, 165 },
+		{ 86, 1, 166 }, { 130, 1, 166 }, { 68, 1, 166 }, { 82, 1, 166 },
+		{ 99, 1, 166 }, { 94, 1, 166 }, { 104, 1, 166 }, { 3, 3, 166 },
+	},
+	{ /* 188 */
+		{ 86, 1, 167 }, { 130, 1, 167 }, { 68, 1, 167 }, { 82, 1, 167 },
+		{ 99, 1, 167 }, { 94, 1, 167 }, { 104, 1, 167 }, { 3, 3, 167 },
+		{ 86, 1, 172 }, { 130, 1, 172 }, { 68, 1, 172 }, { 82, 1, 172 },
+		{ 99, 1, 172 }, { 94, 1, 172 }, { 104, 1, 172 }, { 3, 3, 172 },
+	},
+	{ /* 189 */
+		{ 86, 1, 168 }, { 130, 1, 168 }, { 68, 1, 168 }, { 82, 1, 168 },
+		{ 99, 1, 168 }, { 94, 1, 168 }, { 104, 1, 168 }, { 3, 3, 168 },
+		{ 86, 1, 174 }, { 130, 1, 174 }, { 68, 1, 174 }, { 82, 1, 174 },
+		{ 99, 1, 174 }, { 94, 1, 174 }, { 104, 1, 174 }, { 3, 3, 174 },
+	},
+	{ /* 190 */
+		{ 86, 1, 170 }, { 130, 1, 170 }, { 68, 1, 170 }, { 82, 1, 170 },
+		{ 99, 1, 170 }, { 94, 1, 170 }, { 104, 1, 170 }, { 3, 3, 170 },
+		{ 86, 1, 173 }, { 130, 1, 173 }, { 68, 1, 173 }, { 82, 1, 173 },
+		{ 99, 1, 173 }, { 94, 1, 173 }, { 104, 1, 173 }, { 3, 3, 173 },
+	},
+	{ /* 191 */
+		{ 66, 1, 171 }, { 1, 3, 171 }, { 66, 1, 206 }, { 1, 3, 206 },
+		{ 66, 1, 215 }, { 1, 3, 215 }, { 66, 1, 225 }, { 1, 3, 225 },
+		{ 66, 1, 236 }, { 1, 3, 236 }, { 66, 1, 237 }, { 1, 3, 237 },
+		{ 0, 3, 199 }, { 0, 3, 207 }, { 0, 3, 234 }, { 0, 3, 235 },
+	},
+	{ /* 192 */
+		{ 85, 1, 171 }, { 67, 1, 171 }, { 93, 1, 171 }, { 2, 3, 171 },
+		{ 85, 1, 206 }, { 67, 1, 206 }, { 93, 1, 206 }, { 2, 3, 206 },
+		{ 85, 1, 215 }, { 67, 1, 215 }, { 93, 1, 215 }, { 2, 3, 215 },
+		{ 85, 1, 225 }, { 67, 1, 225 }, { 93, 1, 225 }, { 2, 3, 225 },
+	},
+	{ /* 193 */
+		{ 86, 1, 171 }, { 130, 1, 171 }, { 68, 1, 171 }, { 82, 1, 171 },
+		{ 99, 1, 171 }, { 94, 1, 171 }, { 104, 1, 171 }, { 3, 3, 171 },
+		{ 86, 1, 206 }, { 130, 1, 206 }, { 68, 1, 206 }, { 82, 1, 206 },
+		{ 99, 1, 206 }, { 94, 1, 206 }, { 104, 1, 206 }, { 3, 3, 206 },
+	},
+	{ /* 194 */
+		{ 85, 1, 175 }, { 67, 1, 175 }, { 93, 1, 175 }, { 2, 3, 175 },
+		{ 85, 1, 180 }, { 67, 1, 180 }, { 93, 1, 180 }, { 2, 3, 180 },
+		{ 85, 1, 182 }, { 67, 1, 182 }, { 93, 1, 182 }, { 2, 3, 182 },
+		{ 85, 1, 183 }, { 67, 1, 183 }, { 93, 1, 183 }, { 2, 3, 183 },
+	},
+	{ /* 195 */
+		{ 86, 1, 175 }, { 130, 1, 175 }, { 68, 1, 175 }, { 82, 1, 175 },
+		{ 99, 1, 175 }, { 94, 1, 175 }, { 104, 1, 175 }, { 3, 3, 175 },
+		{ 86, 1, 180 }, { 130, 1, 180 }, { 68, 1, 180 }, { 82, 1, 180 },
+		{ 99, 1, 180 }, { 94, 1, 180 }, { 104, 1, 180 }, { 3, 3, 180 },
+	},
+	{ /* 196 */
+		{ 66, 1, 176 }, { 1, 3, 176 }, { 66, 1, 177 }, { 1, 3, 177 },
+		{ 66, 1, 179 }, { 1, 3, 179 }, { 66, 1, 209 }, { 1, 3, 209 },
+		{ 66, 1, 216 }, { 1, 3, 216 }, { 66, 1, 217 }, { 1, 3, 217 },
+		{ 66, 1, 227 }, { 1, 3, 227 }, { 66, 1, 229 }, { 1, 3, 229 },
+	},
+	{ /* 197 */
+		{ 85, 1, 176 }, { 67, 1, 176 }, { 93, 1, 176 }, { 2, 3, 176 },
+		{ 85, 1, 177 }, { 67, 1, 177 }, { 93, 1, 177 }, { 2, 3, 177 },
+		{ 85, 1, 179 }, { 67, 1, 179 }, { 93, 1, 179 }, { 2, 3, 179 },
+		{ 85, 1, 209 }, { 67, 1, 209 }, { 93, 1, 209 }, { 2, 3, 209 },
+	},
+	{ /* 198 */
+		{ 86, 1, 176 }, { 130, 1, 176 }, { 68, 1, 176 }, { 82, 1, 176 },
+		{ 99, 1, 176 }, { 94, 1, 176 }, { 104, 1, 176 }, { 3, 3, 176 },
+		{ 86, 1, 177 }, { 130, 1, 177 }, { 68, 1, 177 }, { 82, 1, 177 },
+		{ 99, 1, 177 }, { 94, 1, 177 }, { 104, 1, 177 }, { 3, 3, 177 },
+	},
+	{ /* 199 */
+		{ 66, 1, 178 }, { 1, 3, 178 }, { 66, 1, 181 }, { 1, 3, 181 },
+		{ 66, 1, 185 }, { 1, 3, 185 }, { 66, 1, 186 }, { 1, 3, 186 },
+		{ 66, 1, 187 }, { 1, 3, 187 }, { 66, 1, 189 }, { 1, 3, 189 },
+		{ 66, 1, 190 }, { 1, 3, 190 }, { 66, 1, 196 }, { 1, 3, 196 },
+	},
+	{ /* 200 */
+		{ 85, 1, 178 }, { 67, 1, 178 }, { 93, 1, 178 }, { 2, 3, 178 },
+		{ 85, 1, 181 }, { 67, 1, 181 }, { 93, 1, 181 }, { 2, 3, 181 },
+		{ 85, 1, 185 }, { 67, 1, 185 }, { 93, 1, 185 }, { 2, 3, 185 },
+		{ 85, 1, 186 }, { 67, 1, 186 }, { 93, 1, 186 }, { 2, 3, 186 },
+	},
+	{ /* 201 */
+		{ 86, 1, 178 }, { 130, 1, 178 }, { 68, 1, 178 }, { 82, 1, 178 },
+		{ 99, 1, 178 }, { 94, 1, 178 }, { 104, 1, 178 }, { 3, 3, 178 },
+		{ 86, 1, 181 }, { 130, 1, 181 }, { 68, 1, 181 }, { 82, 1, 181 },
+		{ 99, 1, 181 }, { 94, 1, 181 }, { 104, 1, 181 }, { 3, 3, 181 },
+	},
+	{ /* 202 */
+		{ 86, 1, 179 }, { 130, 1, 179 }, { 68, 1, 179 }, { 82, 1, 179 },
+		{ 99, 1, 179 }, { 94, 1, 179 }, { 104, 1, 179 }, { 3, 3, 179 },
+		{ 86, 1, 209 }, { 130, 1, 209 }, { 68, 1, 209 }, { 82, 1, 209 },
+		{ 99, 1, 209 }, { 94, 1, 209 }, { 104, 1, 209 }, { 3, 3, 209 },
+	},
+	{ /* 203 */
+		{ 86, 1, 182 }, { 130, 1, 182 }, { 68, 1, 182 }, { 82, 1, 182 },
+		{ 99, 1, 182 }, { 94, 1, 182 }, { 104, 1, 182 }, { 3, 3, 182 },
+		{ 86, 1, 183 }, { 130, 1, 183 }, { 68, 1, 183 }, { 82, 1, 183 },
+		{ 99, 1, 183 }, { 94, 1, 183 }, { 104, 1, 183 }, { 3, 3, 183 },
+	},
+	{ /* 204 */
+		{ 86, 1, 184 }, { 130, 1, 184 }, { 68, 1, 184 }, { 82, 1, 184 },
+		{ 99, 1, 184 }, { 94, 1, 184 }, { 104, 1, 184 }, { 3, 3, 184 },
+		{ 86, 1, 194 }, { 130, 1, 194 }, { 68, 1, 194 }, { 82, 1, 194 },
+		{ 99, 1, 194 }, { 94, 1, 194 }, { 104, 1, 194 }, { 3, 3, 194 },
+	},
+	{ /* 205 */
+		{ 86, 1, 185 }, { 130, 1, 185 }, { 68, 1, 185 }, { 82, 1, 185 },
+		{ 99, 1, 185 }, { 94, 1, 185 }, { 104, 1, 185 }, { 3, 3, 185 },
+		{ 86, 1, 186 }, { 130, 1, 186 }, { 68, 1, 186 }, { 82, 1, 186 },
+		{ 99, 1, 186 }, { 94, 1, 186 }, { 104, 1, 186 }, { 3, 3, 186 },
+	},
+	{ /* 206 */
+		{ 85, 1, 187 }, { 67, 1, 187 }, { 93, 1, 187 }, { 2, 3, 187 },
+		{ 85, 1, 189 }, { 67, 1, 189 }, { 93, 1, 189 }, { 2, 3, 189 },
+		{ 85, 1, 190 }, { 67, 1, 190 }, { 93, 1, 190 }, { 2, 3, 190 },
+		{ 85, 1, 196 }, { 67, 1, 196 }, { 93, 1, 196 }, { 2, 3, 196 },
+	},
+	{ /* 207 */
+		{ 86, 1, 187 }, { 130, 1, 187 }, { 68, 1, 187 }, { 82, 1, 187 },
+		{ 99, 1, 187 }, { 94, 1, 187 }, { 104, 1, 187 }, { 3, 3, 187 },
+		{ 86, 1, 189 }, { 130, 1, 189 }, { 68, 1, 189 }, { 82, 1, 189 },
+		{ 99, 1, 189 }, { 94, 1, 189 }, { 104, 1, 189 }, { 3, 3, 189 },
+	},
+	{ /* 208 */
+		{ 85, 1, 188 }, { 67, 1, 188 }, { 93, 1, 188 }, { 2, 3, 188 },
+		{ 85, 1, 191 }, { 67, 1, 191 }, { 93, 1, 191 }, { 2, 3, 191 },
+		{ 85, 1, 197 }, { 67, 1, 197 }, { 93, 1, 197 }, { 2, 3, 197 },
+		{ 85, 1, 231 }, { 67, 1, 231 }, { 93, 1, 231 }, { 2, 3, 231 },
+	},
+	{ /* 209 */
+		{ 86, 1, 188 }, { 130, 1, 188 }, { 68, 1, 188 }, { 82, 1, 188 },
+		{ 99, 1, 188 }, { 94, 1, 188 }, { 104, 1, 188 }, { 3, 3, 188 },
+		{ 86, 1, 191 }, { 130, 1, 191 }, { 68, 1, 191 }, { 82, 1, 191 },
+		{ 99, 1, 191 }, { 94, 1, 191 }, { 104, 1, 191 }, { 3, 3, 191 },
+	},
+	{ /* 210 */
+		{ 86, 1, 190 }, { 130, 1, 190 }, { 68, 1, 190 }, { 82, 1, 190 },
+		{ 99, 1, 190 }, { 94, 1, 190 }, { 104, 1, 190 }, { 3, 3, 190 },
+		{ 86, 1, 196 }, { 130, 1, 196 }, { 68, 1, 196 }, { 82, 1, 196 },
+		{ 99, 1, 196 }, { 94, 1, 196 }, { 104, 1, 196 }, { 3, 3, 196 },
+	},
+	{ /* 211 */
+		{ 0, 3, 192 }, { 0, 3, 193 }, { 0, 3, 200 }, { 0, 3, 201 },
+		{ 0, 3, 202 }, { 0, 3, 205 }, { 0, 3, 210 }, { 0, 3, 213 },
+		{ 0, 3, 218 }, { 0, 3, 219 }, { 0, 3, 238 }, { 0, 3, 240 },
+		{ 0, 3, 242 }, { 0, 3, 243 }, { 0, 3, 255 }, { 227, 0, 0 },
+	},
+	{ /* 212 */
+		{ 66, 1, 192 }, { 1, 3, 192 }, { 66, 1, 193 }, { 1, 3, 193 },
+		{ 66, 1, 200 }, { 1, 3, 200 }, { 66, 1, 201 }, { 1, 3, 201 },
+		{ 66, 1, 202 }, { 1, 3, 202 }, { 66, 1, 205 }, { 1, 3, 205 },
+		{ 66, 1, 210 }, { 1, 3, 210 }, { 66, 1, 213 }, { 1, 3, 213 },
+	},
+	{ /* 213 */
+		{ 85, 1, 192 }, { 67, 1, 192 }, { 93, 1, 192 }, { 2, 3, 192 },
+		{ 85, 1, 193 }, { 67, 1, 193 }, { 93, 1, 193 }, { 2, 3, 193 },
+		{ 85, 1, 200 }, { 67, 1, 200 }, { 93, 1, 200 }, { 2, 3, 200 },
+		{ 85, 1, 201 }, { 67, 1, 201 }, { 93, 1, 201 }, { 2, 3, 201 },
+	},
+	{ /* 214 */
+		{ 86, 1, 192 }, { 130, 1, 192 }, { 68, 1, 192 }, { 82, 1, 192 },
+		{ 99, 1, 192 }, { 94, 1, 192 }, { 104, 1, 192 }, { 3, 3, 192 },
+		{ 86, 1, 193 }, { 130, 1, 193 }, { 68, 1, 193 }, { 82, 1, 193 },
+		{ 99, 1, 193 }, { 94, 1, 193 }, { 104, 1, 193 }, { 3, 3, 193 },
+	},
+	{ /* 215 */
+		{ 86, 1, 197 }, { 130, 1, 197 }, { 68, 1, 197 }, { 82, 1, 197 },
+		{ 99, 1, 197 }, { 94, 1, 197 }, { 104, 1, 197 }, { 3, 3, 197 },
+		{ 86, 1, 231 }, { 130, 1, 231 }, { 68, 1, 231 }, { 82, 1, 231 },
+		{ 99, 1, 231 }, { 94, 1, 231 }, { 104, 1, 231 }, { 3, 3, 231 },
+	},
+	{ /* 216 */
+		{ 85, 1, 198 }, { 67, 1, 198 }, { 93, 1, 198 }, { 2, 3, 198 },
+		{ 85, 1, 228 }, { 67, 1, 228 }, { 93, 1, 228 }, { 2, 3, 228 },
+		{ 85, 1, 232 }, { 67, 1, 232 }, { 93, 1, 232 }, { 2, 3, 232 },
+		{ 85, 1, 233 }, { 67, 1, 233 }, { 93, 1, 233 }, { 2, 3, 233 },
+	},
+	{ /* 217 */
+		{ 86, 1, 198 }, { 130, 1, 198 }, { 68, 1, 198 }, { 82, 1, 198 },
+		{ 99, 1, 198 }, { 94, 1, 198 }, { 104, 1, 198 }, { 3, 3, 198 },
+		{ 86, 1, 228 }, { 130, 1, 228 }, { 68, 1, 228 }, { 82, 1, 228 },
+		{ 99, 1, 228 }, { 94, 1, 228 }, { 104, 1, 228 }, { 3, 3, 228 },
+	},
+	{ /* 218 */
+		{ 85, 1, 236 }, { 67, 1, 236 }, { 93, 1, 236 }, { 2, 3, 236 },
+		{ 85, 1, 237 }, { 67, 1, 237 }, { 93, 1, 237 }, { 2, 3, 237 },
+		{ 66, 1, 199 }, { 1, 3, 199 }, { 66, 1, 207 }, { 1, 3, 207 },
+		{ 66, 1, 234 }, { 1, 3, 234 }, { 66, 1, 235 }, { 1, 3, 235 },
+	},
+	{ /* 219 */
+		{ 85, 1, 199 }, { 67, 1, 199 }, { 93, 1, 199 }, { 2, 3, 199 },
+		{ 85, 1, 207 }, { 67, 1, 207 }, { 93, 1, 207 }, { 2, 3, 207 },
+		{ 85, 1, 234 }, { 67, 1, 234 }, { 93, 1, 234 }, { 2, 3, 234 },
+		{ 85, 1, 235 }, { 67, 1, 235 }, { 93, 1, 235 }, { 2, 3, 235 },
+	},
+	{ /* 220 */
+		{ 86, 1, 199 }, { 130, 1, 199 }, { 68, 1, 199 }, { 82, 1, 199 },
+		{ 99, 1, 199 }, { 94, 1, 199 }, { 104, 1, 199 }, { 3, 3, 199 },
+		{ 86, 1, 207 }, { 130, 1, 207 }, { 68, 1, 207 }, { 82, 1, 207 },
+		{ 99, 1, 207 }, { 94, 1, 207 }, { 104, 1, 207 }, { 3, 3, 207 },
+	},
+	{ /* 221 */
+		{ 86, 1, 200 }, { 130, 1, 200 }, { 68, 1, 200 }, { 82, 1, 200 },
+		{ 99, 1, 200 }, { 94, 1, 200 }, { 104, 1, 200 }, { 3, 3, 200 },
+		{ 86, 1, 201 }, { 130, 1, 201 }, { 68, 1, 201 }, { 82, 1, 201 },
+		{ 99, 1, 201 }, { 94, 1, 201 }, { 104, 1, 201 }, { 3, 3, 201 },
+	},
+	{ /* 222 */
+		{ 85, 1, 202 }, { 67, 1, 202 }, { 93, 1, 202 }, { 2, 3, 202 },
+		{ 85, 1, 205 }, { 67, 1, 205 }, { 93, 1, 205 }, { 2, 3, 205 },
+		{ 85, 1, 210 }, { 67, 1, 210 }, { 93, 1, 210 }, { 2, 3, 210 },
+		{ 85, 1, 213 }, { 67, 1, 213 }, { 93, 1, 213 }, { 2, 3, 213 },
+	},
+	{ /* 223 */
+		{ 86, 1, 202 }, { 130, 1, 202 }, { 68, 1, 202 }, { 82, 1, 202 },
+		{ 99, 1, 202 }, { 94, 1, 202 }, { 104, 1, 202 }, { 3, 3, 202 },
+		{ 86, 1, 205 }, { 130, 1, 205 }, { 68, 1, 205 }, { 82, 1, 205 },
+		{ 99, 1, 205 }, { 94, 1, 205 }, { 104, 1, 205 }, { 3, 3, 205 },
+	},
+	{ /* 224 */
+		{ 66, 1, 218 }, { 1, 3, 218 }, { 66, 1, 219 }, { 1, 3, 219 },
+		{ 66, 1, 238 }, { 1, 3, 238 }, { 66, 1, 240 }, { 1, 3, 240 },
+		{ 66, 1, 242 }, { 1, 3, 242 }, { 66, 1, 243 }, { 1, 3, 243 },
+		{ 66, 1, 255 }, { 1, 3, 255 }, { 0, 3, 203 }, { 0, 3, 204 },
+	},
+	{ /* 225 */
+		{ 85, 1, 242 }, { 67, 1, 242 }, { 93, 1, 242 }, { 2, 3, 242 },
+		{ 85, 1, 243 }, { 67, 1, 243 }, { 93, 1, 243 }, { 2, 3, 243 },
+		{ 85, 1, 255 }, { 67, 1, 255 }, { 93, 1, 255 }, { 2, 3, 255 },
+		{ 66, 1, 203 }, { 1, 3, 203 }, { 66, 1, 204 }, { 1, 3, 204 },
+	},
+	{ /* 226 */
+		{ 86, 1, 255 }, { 130, 1, 255 }, { 68, 1, 255 }, { 82, 1, 255 },
+		{ 99, 1, 255 }, { 94, 1, 255 }, { 104, 1, 255 }, { 3, 3, 255 },
+		{ 85, 1, 203 }, { 67, 1, 203 }, { 93, 1, 203 }, { 2, 3, 203 },
+		{ 85, 1, 204 }, { 67, 1, 204 }, { 93, 1, 204 }, { 2, 3, 204 },
+	},
+	{ /* 227 */
+		{ 86, 1, 203 }, { 130, 1, 203 }, { 68, 1, 203 }, { 82, 1, 203 },
+		{ 99, 1, 203 }, { 94, 1, 203 }, { 104, 1, 203 }, { 3, 3, 203 },
+		{ 86, 1, 204 }, { 130, 1, 204 }, { 68, 1, 204 }, { 82, 1, 204 },
+		{ 99, 1, 204 }, { 94, 1, 204 }, { 104, 1, 204 }, { 3, 3, 204 },
+	},
+	{ /* 228 */
+		{ 86, 1, 210 }, { 130, 1, 210 }, { 68, 1, 210 }, { 82, 1, 210 },
+		{ 99, 1, 210 }, { 94, 1, 210 }, { 104, 1, 210 }, { 3, 3, 210 },
+		{ 86, 1, 213 }, { 130, 1, 213 }, { 68, 1, 213 }, { 82, 1, 213 },
+		{ 99, 1, 213 }, { 94, 1, 213 }, { 104, 1, 213 }, { 3, 3, 213 },
+	},
+	{ /* 229 */
+		{ 0, 3, 211 }, { 0, 3, 212 }, { 0, 3, 214 }, { 0, 3, 221 },
+		{ 0, 3, 222 }, { 0, 3, 223 }, { 0, 3, 241 }, { 0, 3, 244 },
+		{ 0, 3, 245 }, { 0, 3, 246 }, { 0, 3, 247 }, { 0, 3, 248 },
+		{ 0, 3, 250 }, { 0, 3, 251 }, { 0, 3, 252 }, { 0, 3, 253 },
+	},
+	{ /* 230 */
+		{ 66, 1, 211 }, { 1, 3, 211 }, { 66, 1, 212 }, { 1, 3, 212 },
+		{ 66, 1, 214 }, { 1, 3, 214 }, { 66, 1, 221 }, { 1, 3, 221 },
+		{ 66, 1, 222 }, { 1, 3, 222 }, { 66, 1, 223 }, { 1, 3, 223 },
+		{ 66, 1, 241 }, { 1, 3, 241 }, { 66, 1, 244 }, { 1, 3, 244 },
+	},
+	{ /* 231 */
+		{ 85, 1, 211 }, { 67, 1, 211 }, { 93, 1, 211 }, { 2, 3, 211 },
+		{ 85, 1, 212 }, { 67, 1, 212 }, { 93, 1, 212 }, { 2, 3, 212 },
+		{ 85, 1, 214 }, { 67, 1, 214 }, { 93, 1, 214 }, { 2, 3, 214 },
+		{ 85, 1, 221 }, { 67, 1, 221 }, { 93, 1, 221 }, { 2, 3, 221 },
+	},
+	{ /* 232 */
+		{ 86, 1, 211 }, { 130, 1, 211 }, { 68, 1, 211 }, { 82, 1, 211 },
+		{ 99, 1, 211 }, { 94, 1, 211 }, { 104, 1, 211 }, { 3, 3, 211 },
+		{ 86, 1, 212 }, { 130, 1, 212 }, { 68, 1, 212 }, { 82, 1, 212 },
+		{ 99, 1, 212 }, { 94, 1, 212 }, { 104, 1, 212 }, { 3, 3, 212 },
+	},
+	{ /* 233 */
+		{ 86, 1, 214 }, { 130, 1, 214 }, { 68, 1, 214 }, { 82, 1, 214 },
+		{ 99, 1, 214 }, { 94, 1, 214 }, { 104, 1, 214 }, { 3, 3, 214 },
+		{ 86, 1, 221 }, { 130, 1, 221 }, { 68, 1, 221 }, { 82, 1, 221 },
+		{ 99, 1, 221 }, { 94, 1, 221 }, { 104, 1, 221 }, { 3, 3, 221 },
+	},
+	{ /* 234 */
+		{ 86, 1, 215 }, { 130, 1, 215 }, { 68, 1, 215 }, { 82, 1, 215 },
+		{ 99, 1, 215 }, { 94, 1, 215 }, { 104, 1, 215 }, { 3, 3, 215 },
+		{ 86, 1, 225 }, { 130, 1, 225 }, { 68, 1, 225 }, { 82, 1, 225 },
+		{ 99, 1, 225 }, { 94, 1, 225 }, { 104, 1, 225 }, { 3, 3, 225 },
+	},
+	{ /* 235 */
+		{ 85, 1, 216 }, { 67, 1, 216 }, { 93, 1, 216 }, { 2, 3, 216 },
+		{ 85, 1, 217 }, { 67, 1, 217 }, { 93, 1, 217 }, { 2, 3, 217 },
+		{ 85, 1, 227 }, { 67, 1, 227 }, { 93, 1, 227 }, { 2, 3, 227 },
+		{ 85, 1, 229 }, { 67, 1, 229 }, { 93, 1, 229 }, { 2, 3, 229 },
+	},
+	{ /* 236 */
+		{ 86, 1, 216 }, { 130, 1, 216 }, { 68, 1, 216 }, { 82, 1, 216 },
+		{ 99, 1, 216 }, { 94, 1, 216 }, { 104, 1, 216 }, { 3, 3, 216 },
+		{ 86, 1, 217 }, { 130, 1, 217 }, { 68, 1, 217 }, { 82, 1, 217 },
+		{ 99, 1, 217 }, { 94, 1, 217 }, { 104, 1, 217 }, { 3, 3, 217 },
+	},
+	{ /* 237 */
+		{ 85, 1, 218 }, { 67, 1, 218 }, { 93, 1, 218 }, { 2, 3, 218 },
+		{ 85, 1, 219 }, { 67, 1, 219 }, { 93, 1, 219 }, { 2, 3, 219 },
+		{ 85, 1, 238 }, { 67, 1, 238 }, { 93, 1, 238 }, { 2, 3, 238 },
+		{ 85, 1, 240 }, { 67, 1, 240 }, { 93, 1, 240 }, { 2, 3, 240 },
+	},
+	{ /* 238 */
+		{ 86, 1, 218 }, { 130, 1, 218 }, { 68, 1, 218 }, { 82, 1, 218 },
+		{ 99, 1, 218 }, { 94, 1, 218 }, { 104, 1, 218 }, { 3, 3, 218 },
+		{ 86, 1, 219 }, { 130, 1, 219 }, { 68, 1, 219 }, { 82, 1, 219 },
+		{ 99, 1, 219 }, { 94, 1, 219 }, { 104, 1, 219 }, { 3, 3, 219 },
+	},
+	{ /* 239 */
+		{ 85, 1, 222 }, { 67, 1, 222 }, { 93, 1, 222 }, { 2, 3, 222 },
+		{ 85, 1, 223 }, { 67, 1, 223 }, { 93, 1, 223 }, { 2, 3, 223 },
+		{ 85, 1, 241 }, { 67, 1, 241 }, { 93, 1, 241 }, { 2, 3, 241 },
+		{ 85, 1, 244 }, { 67, 1, 244 }, { 93, 1, 244 }, { 2, 3, 244 },
+	},
+	{ /* 240 */
+		{ 86, 1, 222 }, { 130, 1, 222 }, { 68, 1, 222 }, { 82, 1, 222 },
+		{ 99, 1, 222 }, { 94, 1, 222 }, { 104, 1, 222 }, { 3, 3, 222 },
+		{ 86, 1, 223 }, { 130, 1, 223 }, { 68, 1, 223 }, { 82, 1, 223 },
+		{ 99, 1, 223 }, { 94, 1, 223 }, { 104, 1, 223 }, { 3, 3, 223 },
+	},
+	{ /* 241 */
+		{ 86, 1, 224 }, { 130, 1, 224 }, { 68, 1, 224 }, { 82, 1, 224 },
+		{ 99, 1, 224 }, { 94, 1, 224 }, { 104, 1, 224 }, { 3, 3, 224 },
+		{ 86, 1, 226 }, { 130, 1, 226 }, { 68, 1, 226 }, { 82, 1, 226 },
+		{ 99, 1, 226 }, { 94, 1, 226 }, { 104, 1, 226 }, { 3, 3, 226 },
+	},
+	{ /* 242 */
+		{ 86, 1, 227 }, { 130, 1, 227 }, { 68, 1, 227 }, { 82, 1, 227 },
+		{ 99, 1, 227 }, { 94, 1, 227 }, { 104, 1, 227 }, { 3, 3, 227 },
+		{ 86, 1, 229 }, { 130, 1, 229 }, { 68, 1, 229 }, { 82, 1, 229 },
+		{ 99, 1, 229 }, { 94, 1, 229 }, { 104, 1, 229 }, { 3, 3, 229 },
+	},
+	{ /* 243 */
+		{ 86, 1, 232 }, { 130, 1, 232 }, { 68, 1, 232 }, { 82, 1, 232 },
+		{ 99, 1, 232 }, { 94, 1, 232 }, { 104, 1, 232 }, { 3, 3, 232 },
+		{ 86, 1, 233 }, { 130, 1, 233 }, { 68, 1, 233 }, { 82, 1, 233 },
+		{ 99, 1, 233 }, { 94, 1, 233 }, { 104, 1, 233 }, { 3, 3, 233 },
+	},
+	{ /* 244 */
+		{ 86, 1, 234 }, { 130, 1, 234 }, { 68, 1, 234 }, { 82, 1, 234 },
+		{ 99, 1, 234 }, { 94, 1, 234 }, { 104, 1, 234 }, { 3, 3, 234 },
+		{ 86, 1, 235 }, { 130, 1, 235 }, { 68, 1, 235 }, { 82, 1, 235 },
+		{ 99, 1, 235 }, { 94, 1, 235 }, { 104, 1, 235 }, { 3, 3, 235 },
+	},
+	{ /* 245 */
+		{ 86, 1, 236 }, { 130, 1, 236 }, { 68, 1, 236 }, { 82, 1, 236 },
+		{ 99, 1, 236 }, { 94, 1, 236 }, { 104, 1, 236 }, { 3, 3, 236 },
+		{ 86, 1, 237 }, { 130, 1, 237 }, { 68, 1, 237 }, { 82, 1, 237 },
+		{ 99, 1, 237 }, { 94, 1, 237 }, { 104, 1, 237 }, { 3, 3, 237 },
+	},
+	{ /* 246 */
+		{ 86, 1, 238 }, { 130, 1, 238 }, { 68, 1, 238 }, { 82, 1, 238 },
+		{ 99, 1, 238 }, { 94, 1, 238 }, { 104, 1, 238 }, { 3, 3, 238 },
+		{ 86, 1, 240 }, { 130, 1, 240 }, { 68, 1, 240 }, { 82, 1, 240 },
+		{ 99, 1, 240 }, { 94, 1, 240 }, { 104, 1, 240 }, { 3, 3, 240 },
+	},
+	{ /* 247 */
+		{ 86, 1, 241 }, { 130, 1, 241 }, { 68, 1, 241 }, { 82, 1, 241 },
+		{ 99, 1, 241 }, { 94, 1, 241 }, { 104, 1, 241 }, { 3, 3, 241 },
+		{ 86, 1, 244 }, { 130, 1, 244 }, { 68, 1, 244 }, { 82, 1, 244 },
+		{ 99, 1, 244 }, { 94, 1, 244 }, { 104, 1, 244 }, { 3, 3, 244 },
+	},
+	{ /* 248 */
+		{ 86, 1, 242 }, { 130, 1, 242 }, { 68, 1, 242 }, { 82, 1, 242 },
+		{ 99, 1, 242 }, { 94, 1, 242 }, { 104, 1, 242 }, { 3, 3, 242 },
+		{ 86, 1, 243 }, { 130, 1, 243 }, { 68, 1, 243 }, { 82, 1, 243 },
+		{ 99, 1, 243 }, { 94, 1, 243 }, { 104, 1, 243 }, { 3, 3, 243 },
+	},
+	{ /* 249 */
+		{ 66, 1, 245 }, { 1, 3, 245 }, { 66, 1, 246 }, { 1, 3, 246 },
+		{ 66, 1, 247 }, { 1, 3, 247 }, { 66, 1, 248 }, { 1, 3, 248 },
+		{ 66, 1, 250 }, { 1, 3, 250 }, { 66, 1, 251 }, { 1, 3, 251 },
+		{ 66, 1, 252 }, { 1, 3, 252 }, { 66, 1, 253 }, { 1, 3, 253 },
+	},
+	{ /* 250 */
+		{ 85, 1, 245 }, { 67, 1, 245 }, { 93, 1, 245 }, { 2, 3, 245 },
+		{ 85, 1, 246 }, { 67, 1, 246 }, { 93, 1, 246 }, { 2, 3, 246 },
+		{ 85, 1, 247 }, { 67, 1, 247 }, { 93, 1, 247 }, { 2, 3, 247 },
+		{ 85, 1, 248 }, { 67, 1, 248 }, { 93, 1, 248 }, { 2, 3, 248 },
+	},
+	{ /* 251 */
+		{ 86, 1, 245 }, { 130, 1, 245 }, { 68, 1, 245 }, { 82, 1, 245 },
+		{ 99, 1, 245 }, { 94, 1, 245 }, { 104, 1, 245 }, { 3, 3, 245 },
+		{ 86, 1, 246 }, { 130, 1, 246 }, { 68, 1, 246 }, { 82, 1, 246 },
+		{ 99, 1, 246 }, { 94, 1, 246 }, { 104, 1, 246 }, { 3, 3, 246 },
+	},
+	{ /* 252 */
+		{ 86, 1, 247 }, { 130, 1, 247 }, { 68, 1, 247 }, { 82, 1, 247 },
+		{ 99, 1, 247 }, { 94, 1, 247 }, { 104, 1, 247 }, { 3, 3, 247 },
+		{ 86, 1, 248 }, { 130, 1, 248 }, { 68, 1, 248 }, { 82, 1, 248 },
+		{ 99, 1, 248 }, { 94, 1, 248 }, { 104, 1, 248 }, { 3, 3, 248 },
+	},
+	{ /* 253 */
+		{ 85, 1, 250 }, { 67, 1, 250 }, { 93, 1, 250 }, { 2, 3, 250 },
+		{ 85, 1, 251 }, { 67, 1, 251 }, { 93, 1, 251 }, { 2, 3, 251 },
+		{ 85, 1, 252 }, { 67, 1, 252 }, { 93, 1, 252 }, { 2, 3, 252 },
+		{ 85, 1, 253 }, { 67, 1, 253 }, { 93, 1, 253 }, { 2, 3, 253 },
+	},
+	{ /* 254 */
+		{ 86, 1, 250 }, { 130, 1, 250 }, { 68, 1, 250 }, { 82, 1, 250 },
+		{ 99, 1, 250 }, { 94, 1, 250 }, { 104, 1, 250 }, { 3, 3, 250 },
+		{ 86, 1, 251 }, { 130, 1, 251 }, { 68, 1, 251 }, { 82, 1, 251 },
+		{ 99, 1, 251 }, { 94, 1, 251 }, { 104, 1, 251 }, { 3, 3, 251 },
+	},
+	{ /* 255 */
+		{ 86, 1, 252 }, { 130, 1, 252 }, { 68, 1, 252 }, { 82, 1, 252 },
+		{ 99, 1, 252 }, { 94, 1, 252 }, { 104, 1, 252 }, { 3, 3, 252 },
+		{ 86, 1, 253 }, { 130, 1, 253 }, { 68, 1, 253 }, { 82, 1, 253 },
+		{ 99, 1, 253 }, { 94, 1, 253 }, { 104, 1, 253 }, { 3, 3, 253 },
+	},
+};
+#else
+/*
+ * Huffman decoding tree (256 internal nodes).
+ */
+static const struct hpack_huffman_node huffman_tree[256] = {
+	{ { 66,	1 } },	/* 0 */
+	{ { 93,	2 } },	/* 1 */
+	{ { 104,	3 } },	/* 2 */
+	{ { 119,	4 } },	/* 3 */
+	{ { 144,	5 } },	/* 4 */
+	{ { 75,	6 } },	/* 5 */
+	{ { 123,	7 } },	/* 6 */
+	{ { 71,	8 } },	/* 7 */
+	{ { 77,	9 } },	/* 8 */
+	{ { 73,	10 } },	/* 9 */
+	{ { 11,	13 } },	/* 10 */
+	{ { 12,	102 } },	/* 11 */
+	{ { 256,	292 } },	/* 12 */
+	{ { 127,	14 } },	/* 13 */
+	{ { 128,	15 } },	/* 14 */
+	{ { 98,	16 } },	/* 15 */
+	{ { 379,	17 } },	/* 16 */
+	{ { 124,	18 } },	/* 17 */
+	{ { 150,	19 } },	/* 18 */
+	{ { 20,	25 } },	/* 19 */
+	{ { 199,	21 } },	/* 20 */
+	{ { 216,	22 } },	/* 21 */
+	{ { 23,	162 } },	/* 22 */
+	{ { 24,	161 } },	/* 23 */
+	{ { 257,	391 } },	/* 24 */
+	{ { 167,	26 } },	/* 25 */
+	{ { 41,	27 } },	/* 26 */
+	{ { 191,	28 } },	/* 27 */
+	{ { 211,	29 } },	/* 28 */
+	{ { 229,	30 } },	/* 29 */
+	{ { 31,	45 } },	/* 30 */
+	{ { 32,	38 } },	/* 31 */
+	{ { 33,	35 } },	/* 32 */
+	{ { 510,	34 } },	/* 33 */
+	{ { 258,	259 } },	/* 34 */
+	{ { 36,	37 } },	/* 35 */
+	{ { 260,	261 } },	/* 36 */
+	{ { 262,	263 } },	/* 37 */
+	{ { 39,	52 } },	/* 38 */
+	{ { 40,	51 } },	/* 39 */
+	{ { 264,	267 } },	/* 40 */
+	{ { 208,	42 } },	/* 41 */
+	{ { 43,	165 } },	/* 42 */
+	{ { 495,	44 } },	/* 43 */
+	{ { 265,	398 } },	/* 44 */
+	{ { 55,	46 } },	/* 45 */
+	{ { 63,	47 } },	/* 46 */
+	{ { 147,	48 } },	/* 47 */
+	{ { 505,	49 } },	/* 48 */
+	{ { 50,	59 } },	/* 49 */
+	{ { 266,	269 } },	/* 50 */
+	{ { 268,	270 } },	/* 51 */
+	{ { 53,	54 } },	/* 52 */
+	{ { 271,	272 } },	/* 53 */
+	{ { 273,	274 } },	/* 54 */
+	{ { 56,	60 } },	/* 55 */
+	{ { 57,	58 } },	/* 56 */
+	{ { 275,	276 } },	/* 57 */
+	{ { 277,	279 } },	/* 58 */
+	{ { 278,	512 } },	/* 59 */
+	{ { 61,	62 } },	/* 60 */
+	{ { 280,	281 } },	/* 61 */
+	{ { 282,	283 } },	/* 62 */
+	{ { 64,	65 } },	/* 63 */
+	{ { 284,	285 } },	/* 64 */
+	{ { 286,	287 } },	/* 65 */
+	{ { 85,	67 } },	/* 66 */
+	{ { 68,	82 } },	/* 67 */
+	{ { 143,	69 } },	/* 68 */
+	{ { 70,	81 } },	/* 69 */
+	{ { 288,	293 } },	/* 70 */
+	{ { 72,	79 } },	/* 71 */
+	{ { 289,	290 } },	/* 72 */
+	{ { 380,	74 } },	/* 73 */
+	{ { 291,	318 } },	/* 74 */
+	{ { 76,	80 } },	/* 75 */
+	{ { 294,	298 } },	/* 76 */
+	{ { 319,	78 } },	/* 77 */
+	{ { 295,	299 } },	/* 78 */
+	{ { 296,	297 } },	/* 79 */
+	{ { 300,	315 } },	/* 80 */
+	{ { 301,	302 } },	/* 81 */
+	{ { 83,	90 } },	/* 82 */
+	{ { 84,	89 } },	/* 83 */
+	{ { 303,	307 } },	/* 84 */
+	{ { 86,	130 } },	/* 85 */
+	{ { 87,	88 } },	/* 86 */
+	{ { 304,	305 } },	/* 87 */
+	{ { 306,	353 } },	/* 88 */
+	{ { 308,	309 } },	/* 89 */
+	{ { 91,	92 } },	/* 90 */
+	{ { 310,	311 } },	/* 91 */
+	{ { 312,	313 } },	/* 92 */
+	{ { 99,	94 } },	/* 93 */
+	{ { 138,	95 } },	/* 94 */
+	{ { 142,	96 } },	/* 95 */
+	{ { 97,	103 } },	/* 96 */
+	{ { 314,	322 } },	/* 97 */
+	{ { 316,	352 } },	/* 98 */
+	{ { 100,	132 } },	/* 99 */
+	{ { 101,	129 } },	/* 100 */
+	{ { 317,	321 } },	/* 101 */
+	{ { 320,	347 } },	/* 102 */
+	{ { 323,	324 } },	/* 103 */
+	{ { 105,	112 } },	/* 104 */
+	{ { 106,	109 } },	/* 105 */
+	{ { 107,	108 } },	/* 106 */
+	{ { 325,	326 } },	/* 107 */
+	{ { 327,	328 } },	/* 108 */
+	{ { 110,	111 } },	/* 109 */
+	{ { 329,	330 } },	/* 110 */
+	{ { 331,	332 } },	/* 111 */
+	{ { 113,	116 } },	/* 112 */
+	{ { 114,	115 } },	/* 113 */
+	{ { 333,	334 } },	/* 114 */
+	{ { 335,	336 } },	/* 115 */
+	{ { 117,	118 } },	/* 116 */
+	{ { 337,	338 } },	/* 117 */
+	{ { 339,	340 } },	/* 118 */
+	{ { 120,	136 } },	/* 119 */
+	{ { 121,	122 } },	/* 120 */
+	{ { 341,	342 } },	/* 121 */
+	{ { 343,	345 } },	/* 122 */
+	{ { 344,	346 } },	/* 123 */
+	{ { 125,	155 } },	/* 124 */
+	{ { 126,	148 } },	/* 125 */
+	{ { 348,	451 } },	/* 126 */
+	{ { 349,	382 } },	/* 127 */
+	{ { 350,	381 } },	/* 128 */
+	{ { 351,	354 } },	/* 129 */
+	{ { 131,	135 } },	/* 130 */
+	{ { 355,	357 } },	/* 131 */
+	{ { 133,	134 } },	/* 132 */
+	{ { 356,	358 } },	/* 133 */
+	{ { 359,	360 } },	/* 134 */
+	{ { 361,	367 } },	/* 135 */
+	{ { 137,	141 } },	/* 136 */
+	{ { 362,	363 } },	/* 137 */
+	{ { 139,	140 } },	/* 138 */
+	{ { 364,	365 } },	/* 139 */
+	{ { 366,	368 } },	/* 140 */
+	{ { 369,	374 } },	/* 141 */
+	{ { 370,	373 } },	/* 142 */
+	{ { 371,	372 } },	/* 143 */
+	{ { 145,	146 } },	/* 144 */
+	{ { 375,	376 } },	/* 145 */
+	{ { 377,	378 } },	/* 146 */
+	{ { 383,	476 } },	/* 147 */
+	{ { 464,	149 } },	/* 148 */
+	{ { 384,	386 } },	/* 149 */
+	{ { 196,	151 } },	/* 150 */
+	{ { 152,	178 } },	/* 151 */
+	{ { 153,	158 } },	/* 152 */
+	{ { 486,	154 } },	/* 153 */
+	{ { 385,	388 } },	/* 154 */
+	{ { 156,	175 } },	/* 155 */
+	{ { 157,	204 } },	/* 156 */
+	{ { 387,	418 } },	/* 157 */
+	{ { 159,	160 } },	/* 158 */
+	{ { 389,	390 } },	/* 159 */
+	{ { 392,	402 } },	/* 160 */
+	{ { 393,	394 } },	/* 161 */
+	{ { 163,	164 } },	/* 162 */
+	{ { 395,	396 } },	/* 163 */
+	{ { 397,	399 } },	/* 164 */
+	{ { 166,	171 } },	/* 165 */
+	{ { 400,	401 } },	/* 166 */
+	{ { 168,	185 } },	/* 167 */
+	{ { 169,	173 } },	/* 168 */
+	{ { 170,	172 } },	/* 169 */
+	{ { 403,	405 } },	/* 170 */
+	{ { 404,	415 } },	/* 171 */
+	{ { 406,	407 } },	/* 172 */
+	{ { 174,	181 } },	/* 173 */
+	{ { 408,	411 } },	/* 174 */
+	{ { 241,	176 } },	/* 175 */
+	{ { 177,	188 } },	/* 176 */
+	{ { 409,	417 } },	/* 177 */
+	{ { 179,	183 } },	/* 178 */
+	{ { 180,	182 } },	/* 179 */
+	{ { 410,	412 } },	/* 180 */
+	{ { 413,	414 } },	/* 181 */
+	{ { 416,	419 } },	/* 182 */
+	{ { 184,	190 } },	/* 183 */
+	{ { 420,	425 } },	/* 184 */
+	{ { 186,	194 } },	/* 185 */
+	{ { 187,	189 } },	/* 186 */
+	{ { 421,	422 } },	/* 187 */
+	{ { 423,	428 } },	/* 188 */
+	{ { 424,	430 } },	/* 189 */
+	{ { 426,	429 } },	/* 190 */
+	{ { 192,	218 } },	/* 191 */
+	{ { 193,	234 } },	/* 192 */
+	{ { 427,	462 } },	/* 193 */
+	{ { 195,	203 } },	/* 194 */
+	{ { 431,	436 } },	/* 195 */
+	{ { 197,	235 } },	/* 196 */
+	{ { 198,	202 } },	/* 197 */
+	{ { 432,	433 } },	/* 198 */
+	{ { 200,	206 } },	/* 199 */
+	{ { 201,	205 } },	/* 200 */
+	{ { 434,	437 } },	/* 201 */
+	{ { 435,	465 } },	/* 202 */
+	{ { 438,	439 } },	/* 203 */
+	{ { 440,	450 } },	/* 204 */
+	{ { 441,	442 } },	/* 205 */
+	{ { 207,	210 } },	/* 206 */
+	{ { 443,	445 } },	/* 207 */
+	{ { 209,	215 } },	/* 208 */
+	{ { 444,	447 } },	/* 209 */
+	{ { 446,	452 } },	/* 210 */
+	{ { 212,	224 } },	/* 211 */
+	{ { 213,	222 } },	/* 212 */
+	{ { 214,	221 } },	/* 213 */
+	{ { 448,	449 } },	/* 214 */
+	{ { 453,	487 } },	/* 215 */
+	{ { 217,	243 } },	/* 216 */
+	{ { 454,	484 } },	/* 217 */
+	{ { 245,	219 } },	/* 218 */
+	{ { 220,	244 } },	/* 219 */
+	{ { 455,	463 } },	/* 220 */
+	{ { 456,	457 } },	/* 221 */
+	{ { 223,	228 } },	/* 222 */
+	{ { 458,	461 } },	/* 223 */
+	{ { 237,	225 } },	/* 224 */
+	{ { 248,	226 } },	/* 225 */
+	{ { 511,	227 } },	/* 226 */
+	{ { 459,	460 } },	/* 227 */
+	{ { 466,	469 } },	/* 228 */
+	{ { 230,	249 } },	/* 229 */
+	{ { 231,	239 } },	/* 230 */
+	{ { 232,	233 } },	/* 231 */
+	{ { 467,	468 } },	/* 232 */
+	{ { 470,	477 } },	/* 233 */
+	{ { 471,	481 } },	/* 234 */
+	{ { 236,	242 } },	/* 235 */
+	{ { 472,	473 } },	/* 236 */
+	{ { 238,	246 } },	/* 237 */
+	{ { 474,	475 } },	/* 238 */
+	{ { 240,	247 } },	/* 239 */
+	{ { 478,	479 } },	/* 240 */
+	{ { 480,	482 } },	/* 241 */
+	{ { 483,	485 } },	/* 242 */
+	{ { 488,	489 } },	/* 243 */
+	{ { 490,	491 } },	/* 244 */
+	{ { 492,	493 } },	/* 245 */
+	{ { 494,	496 } },	/* 246 */
+	{ { 497,	500 } },	/* 247 */
+	{ { 498,	499 } },	/* 248 */
+	{ { 250,	253 } },	/* 249 */
+	{ { 251,	252 } },	/* 250 */
+	{ { 501,	502 } },	/* 251 */
+	{ { 503,	504 } },	/* 252 */
+	{ { 254,	255 } },	/* 253 */
+	{ { 506,	507 } },	/* 254 */
+	{ { 508,	509 } },	/* 255 */
+};
+#endif /* HPACK_HUFFMAN_TREE */
+
+/*
+ * Character classes of decoded names and values.
+ */
+static const unsigned char char_class[256] = {
+	0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+};
+
+#endif /* HPACK_TABLES_H */
@@ -36,9 +36,72 @@
 static int	 encode_huffman(const char *);
 static int	 decode_huffman(const char *);
 
+/* Decoders that decode the same data again, each with its own table */
+struct decoders {
+	struct hpack_table	*dc_fields;	/* into fields */
+	struct hpack_table	*dc_lazy;	/* into fields with lazy values */
+	struct hpack_table	*dc_cb;		/* with a callback and validation */
+	struct hpack_table	*dc_pseudo;	/* with separate pseudo-headers */
+	struct hpack_table	*dc_stream;	/* in fragments */
+	struct hpack_decoder	*dc_dec;
+};
+
+static int	 decoders_new(struct decoders *, size_t);
+static void	 decoders_free(struct decoders *);
+
+static void	*regress_malloc(size_t, void *);
+static void	*regress_realloc(void *, size_t, void *);
+static void	 regress_free(void *, void *);
+
 int	 verbose;
 int	 encode;
 
+/* Count the allocations of the decoding tables to find leaks */
+static long	 regress_allocs;
+static size_t	 regress_maxsize;	/* largest allocation */
+static const struct hpack_allocator regress_allocator = {
+	regress_malloc,
+	regress_realloc,
+	regress_free,
+	&regress_allocs,
+	HPACK_ALLOC_ARENA
+};
+
+static void *
+regress_malloc(size_t size, void *arg)
+{
+	long	*allocs = arg;
+	void	*ptr;
+
+	if ((ptr = malloc(size)) != NULL)
+		(*allocs)++;
+	if (size > regress_maxsize)
+		regress_maxsize = size;
+	return (ptr);
+}
+
+static void *
+regress_realloc(void *ptr, size_t size, void *arg)
+{
+	long	*allocs = arg;
+	void	*newptr;
+
+	if ((newptr = realloc(ptr, size)) != NULL && ptr == NULL)
+		(*allocs)++;
+	if (size > regress_maxsize)
+		regress_maxsize = size;
+	return (newptr);
+}
+
+static void
+regress_free(void *ptr, void *arg)
+{
+	long	*allocs = arg;
+
+	(*allocs)--;
+	free(ptr);
+}
+
 static void
 log(int level, const char *fmt, ...)
 {
@@ -135,6 +198,145 @@ hpack_headerblock_cmp(struct hpack_headerblock *a,
 	return (0);
 }
 
+static int
+hpack_token_cmp(struct hpack_headerblock *hdrs)
+{
+	static const struct {
+		const char		*name;
+		enum hpack_token	 token;
+	} tokens[] = {
+		{ ":authority",		HPACK_TOKEN_AUTHORITY },
+		{ ":method",		HPACK_TOKEN_METHOD },
+		{ ":path",		HPACK_TOKEN_PATH },
+		{ ":scheme",		HPACK_TOKEN_SCHEME },
+		{ ":status",		HPACK_TOKEN_STATUS },
+		{ "accept",		HPACK_TOKEN_ACCEPT },
+		{ "cache-control",	HPACK_TOKEN_CACHE_CONTROL },
+		{ "content-type",	HPACK_TOKEN_CONTENT_TYPE },
+		{ "cookie",		HPACK_TOKEN_COOKIE },
+		{ "set-cookie",		HPACK_TOKEN_SET_COOKIE },
+		{ "www-authenticate",	HPACK_TOKEN_WWW_AUTHENTICATE },
+		{ "te",			HPACK_TOKEN_UNKNOWN },
+		{ "x-forwarded-for",	HPACK_TOKEN_UNKNOWN },
+		{ "Content-Type",	HPACK_TOKEN_UNKNOWN }
+	};
+	struct hpack_header	*hdr;
+	size_t			 i;
+
+	/* Check the tokens of some indexed and literal names */
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		for (i = 0; i < sizeof(tokens) / sizeof(tokens[0]); i++) {
+			if (strcmp(hdr->hdr_name, tokens[i].name) != 0)
+				continue;
+			if (hdr->hdr_token != tokens[i].token)
+				return (-1);
+			break;
+		}
+	}
+
+	return (0);
+}
+
+static int
+hpack_field_cmp(const struct hpack_field *hf, void *arg)
+{
+	struct hpack_header	**hbp = arg, *hb = *hbp;
+
+	/* Compare each field of the callback with the next header */
+	if (hb == NULL ||
+	    hf->hpf_name_len != strlen(hb->hdr_name) ||
+	    memcmp(hf->hpf_name, hb->hdr_name, hf->hpf_name_len) != 0 ||
+	    hf->hpf_value_len != strlen(hb->hdr_value) ||
+	    memcmp(hf->hpf_value, hb->hdr_value, hf->hpf_value_len) != 0 ||
+	    hf->hpf_index != hb->hdr_index ||
+	    hf->hpf_token != hb->hdr_token)
+		return (-1);
+	*hbp = TAILQ_NEXT(hb, hdr_entry);
+
+	return (0);
+}
+
+static int
+hpack_fieldblock_cmp(struct hpack_fieldblock *a,
+    struct hpack_headerblock *b)
+{
+	struct hpack_field	*hf;
+	struct hpack_header	*hb;
+	size_t			 i;
+
+	for (i = 0, hb = TAILQ_FIRST(b);
+	    i < a->hfb_nfields && hb != NULL;
+	    i++, hb = TAILQ_NEXT(hb, hdr_entry)) {
+		hf = &a->hfb_fields[i];
+		if (hf->hpf_name_len != strlen(hb->hdr_name) ||
+		    memcmp(hf->hpf_name, hb->hdr_name, hf->hpf_name_len) != 0)
+			return (-2);
+		if (hf->hpf_value_len != strlen(hb->hdr_value) ||
+		    memcmp(hf->hpf_value, hb->hdr_value,
+		    hf->hpf_value_len) != 0)
+			return (-3);
+		if (hf->hpf_token != hb->hdr_token)
+			return (-4);
+	}
+	if (i != a->hfb_nfields || hb != NULL)
+		return (-1);
+
+	return (0);
+}
+
+static int
+hpack_pseudo_cmp(struct hpack_pseudo *hpp, struct hpack_headerblock *a,
+    struct hpack_headerblock *b)
+{
+	struct hpack_header	*ha, *hb;
+	struct hpack_view	*hpv;
+
+	/* The pseudo-headers are removed from the regular headers */
+	for (ha = TAILQ_FIRST(a), hb = TAILQ_FIRST(b); hb != NULL;
+	    hb = TAILQ_NEXT(hb, hdr_entry)) {
+		if (strcmp(hb->hdr_name, ":method") == 0)
+			hpv = &hpp->hpp_method;
+		else if (strcmp(hb->hdr_name, ":scheme") == 0)
+			hpv = &hpp->hpp_scheme;
+		else if (strcmp(hb->hdr_name, ":authority") == 0)
+			hpv = &hpp->hpp_authority;
+		else if (strcmp(hb->hdr_name, ":path") == 0)
+			hpv = &hpp->hpp_path;
+		else if (strcmp(hb->hdr_name, ":status") == 0)
+			hpv = &hpp->hpp_status;
+		else
+			hpv = NULL;
+		if (hpv != NULL) {
+			if (hpv->hpv_str == NULL ||
+			    hpv->hpv_len != strlen(hb->hdr_value) ||
+			    strcmp(hpv->hpv_str, hb->hdr_value) != 0)
+				return (-2);
+			continue;
+		}
+		if (ha == NULL ||
+		    strcmp(ha->hdr_name, hb->hdr_name) != 0 ||
+		    strcmp(ha->hdr_value, hb->hdr_value) != 0 ||
+		    ha->hdr_token != hb->hdr_token)
+			return (-3);
+		ha = TAILQ_NEXT(ha, hdr_entry);
+	}
+	if (ha != NULL)
+		return (-1);
+
+	/* Check the parsed values */
+	if ((hpp->hpp_method_id == HPACK_METHOD_NONE) !=
+	    (hpp->hpp_method.hpv_str == NULL) ||
+	    (hpp->hpp_method_id == HPACK_METHOD_GET) !=
+	    (hpp->hpp_method.hpv_str != NULL &&
+	    strcmp(hpp->hpp_method.hpv_str, "GET") == 0))
+		return (-4);
+	if (hpp->hpp_status.hpv_str != NULL &&
+	    hpp->hpp_status_code != atoi(hpp->hpp_status.hpv_str))
+		return (-5);
+
+	return (0);
+}
+
 static int
 hpack_headerblock_print(const char *prefix, struct hpack_headerblock *hdrs)
 {
@@ -204,9 +406,172 @@ parsehex(const char *hex, unsigned char *buf, size_t len)
 	return (datalen);
 }
 
+static int
+parse_stream(unsigned char *buf, size_t len,
+    struct hpack_headerblock *test, struct hpack_decoder *dec)
+{
+	struct hpack_headerblock	*hdrs = NULL;
+	size_t				 off, fraglen;
+	int				 ret = -1;
+
+	if ((hdrs = hpack_headerblock_new()) == NULL)
+		goto fail;
+
+	/* Feed the data in fragments of increasing size */
+	for (off = 0, fraglen = 1; off < len; off += fraglen, fraglen++) {
+		if (fraglen > len - off)
+			fraglen = len - off;
+		if (hpack_decoder_feed(dec, buf + off, fraglen, hdrs) == -1) {
+			log(2, "hpack_decoder_feed\n");
+			goto fail;
+		}
+	}
+	if (hpack_decoder_finish(dec) == -1) {
+		log(2, "hpack_decoder_finish\n");
+		goto fail;
+	}
+	if ((ret = hpack_headerblock_cmp(hdrs, test)) != 0) {
+		log(2, "stream headers mismatched (returned %d)\n", ret);
+		ret = -1;
+		goto fail;
+	}
+
+	ret = 0;
+ fail:
+	hpack_headerblock_free(hdrs);
+	free(hdrs);
+	return (ret);
+}
+
+static int
+decoders_new(struct decoders *dcs, size_t table_size)
+{
+	memset(dcs, 0, sizeof(*dcs));
+	if ((dcs->dc_fields = hpack_table_new(table_size)) == NULL ||
+	    (dcs->dc_lazy = hpack_table_new(table_size)) == NULL ||
+	    (dcs->dc_cb = hpack_table_new(table_size)) == NULL ||
+	    hpack_table_setvalidate(1, dcs->dc_cb) == -1 ||
+	    (dcs->dc_pseudo = hpack_table_new_allocator(table_size,
+	    &regress_allocator)) == NULL ||
+	    (dcs->dc_stream = hpack_table_new(table_size)) == NULL ||
+	    (dcs->dc_dec = hpack_decoder_new(dcs->dc_stream)) == NULL) {
+		decoders_free(dcs);
+		return (-1);
+	}
+	return (0);
+}
+
+static void
+decoders_free(struct decoders *dcs)
+{
+	hpack_table_free(dcs->dc_fields);
+	hpack_table_free(dcs->dc_lazy);
+	hpack_table_free(dcs->dc_cb);
+	hpack_table_free(dcs->dc_pseudo);
+	hpack_decoder_free(dcs->dc_dec);
+	hpack_table_free(dcs->dc_stream);
+	memset(dcs, 0, sizeof(*dcs));
+}
+
+static int
+parse_decoders(unsigned char *buf, size_t len,
+    struct hpack_headerblock *hdrs, struct decoders *dcs)
+{
+	struct hpack_headerblock	*rhdrs = NULL;
+	struct hpack_block		*hbk = NULL;
+	struct hpack_fieldblock		*hfb = NULL, *lfb = NULL;
+	struct hpack_field		*hf;
+	struct hpack_header		*hdr;
+	struct hpack_pseudo		 hpp;
+	unsigned char			*wire = NULL;
+	size_t				 i, wirelen;
+	int				 ret = -1;
+
+	/* Decode the same data again in fragments */
+	if (parse_stream(buf, len, hdrs, dcs->dc_dec) == -1)
+		goto fail;
+
+	/* Decode the same data again into views */
+	if ((hfb = hpack_decode_fields(buf, len, dcs->dc_fields)) == NULL) {
+		log(2, "hpack_decode_fields\n");
+		goto fail;
+	}
+	if ((ret = hpack_fieldblock_cmp(hfb, hdrs)) != 0) {
+		log(2, "fields mismatched (returned %d)\n", ret);
+		ret = -1;
+		goto fail;
+	}
+
+	/* Decode the same data again and the values on first access */
+	if ((lfb = hpack_decode_fields_lazy(buf, len,
+	    dcs->dc_lazy)) == NULL) {
+		log(2, "hpack_decode_fields_lazy\n");
+		ret = -1;
+		goto fail;
+	}
+
+	/* Relay the fields with their Huffman code to a new table */
+	if ((wire = hpack_encode_fields(lfb->hfb_fields,
+	    lfb->hfb_nfields, &wirelen, NULL)) == NULL ||
+	    (rhdrs = hpack_decode(wire, wirelen, NULL)) == NULL ||
+	    (ret = hpack_headerblock_cmp(rhdrs, hdrs)) != 0) {
+		log(2, "relayed fields mismatched\n");
+		ret = -1;
+		goto fail;
+	}
+	for (i = 0; i < lfb->hfb_nfields; i++) {
+		hf = &lfb->hfb_fields[i];
+		if (hpack_field_decode(lfb, hf) == -1 ||
+		    hpack_field_decode(lfb, hf) == -1 ||
+		    (hf->hpf_flags & HPACK_FIELD_HUFFMAN)) {
+			log(2, "hpack_field_decode\n");
+			ret = -1;
+			goto fail;
+		}
+	}
+	if ((ret = hpack_fieldblock_cmp(lfb, hdrs)) != 0) {
+		log(2, "lazy fields mismatched (returned %d)\n", ret);
+		ret = -1;
+		goto fail;
+	}
+
+	/* Decode the same data again with a callback and validation */
+	hdr = TAILQ_FIRST(hdrs);
+	if (hpack_decode_cb(buf, len, dcs->dc_cb,
+	    hpack_field_cmp, &hdr) == -1 || hdr != NULL) {
+		log(2, "callback fields mismatched\n");
+		ret = -1;
+		goto fail;
+	}
+
+	/* Decode the same data again with separate pseudo-headers */
+	if ((hbk = hpack_decode_pseudo(buf, len,
+	    &hpp, dcs->dc_pseudo)) == NULL) {
+		log(2, "hpack_decode_pseudo\n");
+		ret = -1;
+		goto fail;
+	}
+	if ((ret = hpack_pseudo_cmp(&hpp, &hbk->hbk_headers, hdrs)) != 0) {
+		log(2, "pseudo-headers mismatched (returned %d)\n", ret);
+		ret = -1;
+		goto fail;
+	}
+
+	ret = 0;
+ fail:
+	hpack_fieldblock_free(hfb);
+	hpack_fieldblock_free(lfb);
+	hpack_headerblock_free(rhdrs);
+	free(rhdrs);
+	hpack_block_free(hbk);
+	free(wire);
+	return (ret);
+}
+
 static int
 parse_data(unsigned char *buf, size_t len,
-    struct hpack_headerblock *test, struct hpack_table *hpack)
+    struct hpack_headerblock *test, struct hpack_table *hpack,
+    struct decoders *dcs)
 {
 	struct hpack_headerblock	*hdrs = NULL;
 	int				 ret = -1;
@@ -229,6 +594,16 @@ parse_data(unsigned char *buf, size_t len,
 		ret = -1;
 		goto fail;
 	}
+	if (hpack_token_cmp(hdrs) != 0) {
+		log(2, "header tokens mismatched\n");
+		ret = -1;
+		goto fail;
+	}
+
+	/* Decode the same data again with the other decoders */
+	if (dcs != NULL &&
+	    (ret = parse_decoders(buf, len, hdrs, dcs)) == -1)
+		goto fail;
 
 	ret = 0;
  fail:
@@ -237,12 +612,13 @@ parse_data(unsigned char *buf, size_t len,
 		hpack_headerblock_print("<<< parsed:", hdrs);
 	}
 	hpack_headerblock_free(hdrs);
+	free(hdrs);
 	return (ret);
 }
 
 static int
 parse_hex(const char *hex, struct hpack_headerblock *test,
-    struct hpack_table *hpack)
+    struct hpack_table *hpack, struct decoders *dcs)
 {
 	unsigned char			 buf[8192];
 	ssize_t				 len;
@@ -252,7 +628,7 @@ parse_hex(const char *hex, struct hpack_headerblock *test,
 		return (-1);
 	}
 
-	if (parse_data(buf, len, test, hpack) == -1)
+	if (parse_data(buf, len, test, hpack, dcs) == -1)
 		return (-1);
 
 	log(2, ">>> wire: %s\n", hex);
@@ -263,6 +639,7 @@ static ssize_t
 parse_input(const char *name, size_t init_table_size)
 {
 	struct hpack_table	*hpack = NULL;
+	struct decoders		 dcs;
 	FILE			*fp;
 	char			 buf[BUFSIZ];
 	ssize_t			 ok = 0, ret = -1;
@@ -274,12 +651,15 @@ parse_input(const char *name, size_t init_table_size)
 	else if ((fp = fopen(name, "r")) == NULL)
 		return (-1);
 
-	if ((hpack = hpack_table_new(init_table_size)) == NULL)
+	if (decoders_new(&dcs, init_table_size) == -1)
+		goto done;
+	if ((hpack = hpack_table_new_allocator(init_table_size,
+	    &regress_allocator)) == NULL)
 		goto done;
 
 	while (fgets(buf, sizeof(buf), fp) != NULL) {
 		buf[strcspn(buf, "\r\n")] = '\0';
-		if (parse_hex(buf, NULL, hpack) == -1) {
+		if (parse_hex(buf, NULL, hpack, &dcs) == -1) {
 			log(1, "hex HPACK decoding failed\n");
 			goto done;
 		}
@@ -291,6 +671,7 @@ parse_input(const char *name, size_t init_table_size)
 	if (fp != NULL && fp != stdin)
 		fclose(fp);
 	hpack_table_free(hpack);
+	decoders_free(&dcs);
 
 	return (ret);
 }
@@ -303,7 +684,7 @@ parse_raw(const char *name, size_t init_table_size)
 	struct hpack_headerblock	*hdrs = NULL;
 	FILE				*fp;
 	int				 ret = -1;
-	size_t				 len;
+	size_t				 len, klen;
 
 	if (strcmp("-", name) == 0)
 		fp = stdin;
@@ -318,18 +699,22 @@ parse_raw(const char *name, size_t init_table_size)
 			buf[strcspn(buf, "\r\n")] = '\0';
 			k = buf;
 			if ((v = strchr(k + 1, ':')) != NULL) {
-				*v++ = '\0';
+				/* the name is not NUL-terminated */
+				klen = v++ - k;
 				v += strspn(v, " \t");
 			} else if (isupper(buf[0])) {
 				/* cheap way to test for the method */
 				buf[strcspn(buf, " \t")] = '\0';
 				k = ":method";
+				klen = strlen(k);
 				v = buf;
-			} else
+			} else {
+				klen = strlen(k);
 				v = "";
-			log(2, "adding header '%s: %s'\n", k, v);
-			if (hpack_header_add(hdrs,
-			    k, v, HPACK_INDEX) == NULL)
+			}
+			log(2, "adding header '%.*s: %s'\n", (int)klen, k, v);
+			if (hpack_header_add_len(hdrs,
+			    k, klen, v, strlen(v), HPACK_INDEX) == NULL)
 				goto done;
 		}
 		if ((ptr = hpack_encode(hdrs, &len, hpack)) == NULL) {
@@ -357,7 +742,133 @@ parse_raw(const char *name, size_t init_table_size)
 	if (fp != NULL && fp != stdin)
 		fclose(fp);
 	hpack_headerblock_free(hdrs);
+	free(hdrs);
+	hpack_table_free(hpack);
+
+	return (ret);
+}
+
+static ssize_t
+parse_invalid(const char *name, size_t init_table_size)
+{
+	struct hpack_table		*hpack = NULL, *check = NULL;
+	struct hpack_headerblock	*hdrs = NULL;
+	struct hpack_error		 hpe;
+	FILE				*fp;
+	char				 buf[BUFSIZ], code[16];
+	unsigned char			 data[8192];
+	size_t				 offset, pos;
+	ssize_t				 len, ok = 0, ret = -1;
+	int				 hex, nul;
+	enum hpack_errcode		 errcode;
+
+	if ((fp = fopen(name, "r")) == NULL)
+		return (-1);
+
+	while (fgets(buf, sizeof(buf), fp) != NULL) {
+		buf[strcspn(buf, "\r\n")] = '\0';
+
+		/* Each line is "[nul-]<code> <offset> <position> <hex>" */
+		if (sscanf(buf, "%15s %zu %zu %n",
+		    code, &offset, &pos, &hex) != 3 ||
+		    (len = parsehex(buf + hex, data, sizeof(data))) == -1) {
+			log(1, "invalid test line: %s\n", buf);
+			goto done;
+		}
+		/* NUL is rejected even without validation */
+		nul = strncmp("nul-", code, 4) == 0;
+		if (nul)
+			memmove(code, code + 4, strlen(code + 4) + 1);
+		if (strcmp("uppercase", code) == 0)
+			errcode = HPACK_ERR_NAME_UPPERCASE;
+		else if (strcmp("name", code) == 0)
+			errcode = HPACK_ERR_NAME_CHAR;
+		else if (strcmp("value", code) == 0)
+			errcode = HPACK_ERR_VALUE_CHAR;
+		else {
+			log(1, "invalid error code: %s\n", code);
+			goto done;
+		}
+
+		hpack_table_free(hpack);
+		hpack_table_free(check);
+		if ((hpack = hpack_table_new(init_table_size)) == NULL ||
+		    (check = hpack_table_new(init_table_size)) == NULL ||
+		    hpack_table_setvalidate(1, check) == -1)
+			goto done;
+
+		/* The header block is only rejected if validation is on */
+		if (nul) {
+			if ((hdrs = hpack_decode(data, len, hpack)) != NULL) {
+				log(1, "hpack_decode of NUL succeeded\n");
+				goto done;
+			}
+			hpack_table_error(hpack, &hpe);
+			if (hpe.hpe_code != errcode ||
+			    hpe.hpe_offset != offset || hpe.hpe_pos != pos) {
+				log(1, "NUL error mismatched: %d %zu %zu\n",
+				    hpe.hpe_code, hpe.hpe_offset, hpe.hpe_pos);
+				goto done;
+			}
+		} else if ((hdrs = hpack_decode(data, len, hpack)) == NULL) {
+			log(1, "hpack_decode without validation failed\n");
+			goto done;
+		}
+		hpack_headerblock_free(hdrs);
+		free(hdrs);
+		if ((hdrs = hpack_decode(data, len, check)) != NULL) {
+			log(1, "hpack_decode with validation succeeded\n");
+			goto done;
+		}
+
+		hpack_table_error(check, &hpe);
+		if (hpe.hpe_code != errcode || hpe.hpe_offset != offset ||
+		    hpe.hpe_pos != pos) {
+			log(1, "validation error mismatched: "
+			    "%d %zu %zu 0x%02x\n", hpe.hpe_code,
+			    hpe.hpe_offset, hpe.hpe_pos, hpe.hpe_char);
+			goto done;
+		}
+		log(2, ">>> invalid: %s\n", buf);
+		ok++;
+	}
+
+	ret = ok;
+ done:
+	fclose(fp);
+	hpack_headerblock_free(hdrs);
+	free(hdrs);
 	hpack_table_free(hpack);
+	hpack_table_free(check);
+
+	return (ret);
+}
+
+static int
+encode_fields(struct hpack_headerblock *hdrs, unsigned char *data,
+    size_t len, size_t *encoded_len, struct hpack_table *hpack)
+{
+	struct hpack_header	*hdr;
+	struct hpack_field	*hf = NULL;
+	size_t			 n = 0;
+	int			 ret;
+
+	/* Encode the headers again from an array that points to them */
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry)
+		n++;
+	if (n > 0 && (hf = calloc(n, sizeof(*hf))) == NULL)
+		return (-1);
+	n = 0;
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		hf[n].hpf_name = hdr->hdr_name;
+		hf[n].hpf_name_len = strlen(hdr->hdr_name);
+		hf[n].hpf_value = hdr->hdr_value;
+		hf[n].hpf_value_len = strlen(hdr->hdr_value);
+		hf[n].hpf_index = hdr->hdr_index;
+		n++;
+	}
+	ret = hpack_encode_fields_buf(hf, n, data, len, encoded_len, hpack);
+	free(hf);
 
 	return (ret);
 }
@@ -366,10 +877,15 @@ static int
 parse_dir(char *argv[], size_t init_table_size)
 {
 	struct hpack_table		*hpack = NULL, *hpack2 = NULL;
+	struct hpack_table		*hpack3 = NULL, *array = NULL;
+	struct hpack_table		*policy = NULL, *policydec = NULL;
+	struct decoders			 dcs;
 	struct hpack_headerblock	*test = NULL;
 	FTS				*fts;
 	FTSENT				*ftsp = NULL;
 	char				*str = NULL, *wire = NULL, *tblsz;
+	unsigned char			*data = NULL;
+	unsigned char			 buf[8192];
 	FILE				*fp;
 	off_t				 size;
 	int				 ret = -1;
@@ -377,10 +893,13 @@ parse_dir(char *argv[], size_t init_table_size)
 	size_t				 i = 0, j, k;
 	ssize_t				 ok = 0;
 	const char			*errstr = NULL;
-	size_t				 table_size, file_table_size, len;
+	size_t				 table_size, file_table_size, len, buflen;
+	size_t				 encoded = 0;
+	struct hpack_stats		 hst;
 
 	if (encode)
 		return (-1);
+	memset(&dcs, 0, sizeof(dcs));
 	if ((fts = fts_open(argv, FTS_COMFOLLOW|FTS_NOCHDIR,
 	    NULL)) == NULL) {
 		errstr = "failed to open directory";
@@ -410,6 +929,14 @@ parse_dir(char *argv[], size_t init_table_size)
 			}
 			ok = 1;
 			goto next;
+		} else if (fnmatch("*.hpackinvalid", ftsp->fts_name,
+		    FNM_PATHNAME) != FNM_NOMATCH) {
+			if ((ok = parse_invalid(ftsp->fts_accpath,
+			    file_table_size)) < 0) {
+				errstr = "invalid input file parsing failed";
+				goto done;
+			}
+			goto next;
 		} else if (fnmatch("headers_??.txt", ftsp->fts_name,
 		    FNM_PATHNAME) != FNM_NOMATCH) {
 			if (encode_huffman(ftsp->fts_accpath) == -1) {
@@ -498,8 +1025,9 @@ parse_dir(char *argv[], size_t init_table_size)
 			if (hpack == NULL) {
 				if (table_size > file_table_size)
 					file_table_size = table_size;
-				if ((hpack =
-				    hpack_table_new(file_table_size)) == NULL) {
+				if ((hpack = hpack_table_new_allocator(
+				    file_table_size,
+				    &regress_allocator)) == NULL) {
 					errstr = "failed to get HPACK table";
 					goto done;
 				}
@@ -508,9 +1036,30 @@ parse_dir(char *argv[], size_t init_table_size)
 					errstr = "failed to get HPACK table";
 					goto done;
 				}
+				if (decoders_new(&dcs,
+				    file_table_size) == -1) {
+					errstr = "failed to get HPACK decoders";
+					goto done;
+				}
+				if ((hpack3 =
+				    hpack_table_new(file_table_size)) == NULL ||
+				    (array =
+				    hpack_table_new(file_table_size)) == NULL) {
+					errstr = "failed to get HPACK table";
+					goto done;
+				}
+				if ((policy =
+				    hpack_table_new(file_table_size)) == NULL ||
+				    hpack_table_setpolicy(HPACK_POLICY_FREQUENCY,
+				    policy) == -1 ||
+				    (policydec =
+				    hpack_table_new(file_table_size)) == NULL) {
+					errstr = "failed to get HPACK table";
+					goto done;
+				}
 			}
 
-			if (parse_hex(wire, test, hpack) == -1) {
+			if (parse_hex(wire, test, hpack, &dcs) == -1) {
 				errstr = "failed to parse HPACK";
 				goto done;
 			}
@@ -526,22 +1075,76 @@ parse_dir(char *argv[], size_t init_table_size)
 				errstr = "re-encoding failed";
 				goto done;
 			}
-			if (parse_data(wire, len, test, hpack2) == -1) {
+			if (parse_data(wire, len, test, hpack2, NULL) == -1) {
 				errstr = "re-decoding failed";
 				goto done;
 			}
 
+			/* Encoding into a buffer must return the same data */
+			if (hpack_encode_buf(test, buf, sizeof(buf),
+			    &buflen, hpack3) == -1 || buflen != len ||
+			    memcmp(buf, wire, len) != 0) {
+				errstr = "re-encoding into buffer failed";
+				goto done;
+			}
+			encoded += buflen;
+
+			/* Encoding from an array must return the same data */
+			if (encode_fields(test, buf, sizeof(buf),
+			    &buflen, array) == -1 || buflen != len ||
+			    memcmp(buf, wire, len) != 0) {
+				errstr = "re-encoding from array failed";
+				goto done;
+			}
+
+			/* The admission policy must not break the decoder */
+			if ((data = hpack_encode(test, &len, policy)) == NULL) {
+				errstr = "re-encoding with policy failed";
+				goto done;
+			}
+			if (parse_data(data, len, test, policydec,
+			    NULL) == -1) {
+				errstr = "re-decoding with policy failed";
+				goto done;
+			}
+			free(data);
+			data = NULL;
+
 			ok++;
 			hpack_headerblock_free(test);
+			free(test);
 			test = NULL;
 			free(wire);
 			wire = NULL;
 		}
 
+		/* Check the counters of the encoder and the decoder */
+		if (hpack3 != NULL) {
+			hpack_table_stats(hpack3, &hst);
+			if (hst.hst_bytes_out != encoded) {
+				errstr = "invalid encoder statistics";
+				goto done;
+			}
+			hpack_table_stats(hpack, &hst);
+			if (hst.hst_bytes_in == 0 ||
+			    hst.hst_peak_size > file_table_size ||
+			    hst.hst_evictions > hst.hst_inserts) {
+				errstr = "invalid decoder statistics";
+				goto done;
+			}
+		}
+		encoded = 0;
+
 		i = 0;
 		hpack_table_free(hpack);
 		hpack_table_free(hpack2);
-		hpack = hpack2 = NULL;
+		hpack_table_free(hpack3);
+		hpack_table_free(array);
+		hpack_table_free(policy);
+		hpack_table_free(policydec);
+		decoders_free(&dcs);
+		hpack = hpack2 = hpack3 = array = NULL;
+		policy = policydec = NULL;
 		json_free(json);
 		json = NULL;
 		free(str);
@@ -553,6 +1156,10 @@ parse_dir(char *argv[], size_t init_table_size)
 
 	ret = 0;
  done:
+	if (ret == 0 && regress_allocs != 0) {
+		errstr = "allocations leaked";
+		ret = -1;
+	}
 	if (errstr != NULL && ftsp != NULL && i != 0)
 		log(1, "FAILED: %s: %s in test %zu\n",
 		    ftsp->fts_path, errstr, i);
@@ -562,9 +1169,16 @@ parse_dir(char *argv[], size_t init_table_size)
 	else if (errstr != NULL)
 		log(1, "FAILED: %s\n", errstr);
 	free(wire);
+	free(data);
 	hpack_table_free(hpack);
 	hpack_table_free(hpack2);
+	hpack_table_free(hpack3);
+	hpack_table_free(array);
+	hpack_table_free(policy);
+	hpack_table_free(policydec);
+	decoders_free(&dcs);
 	hpack_headerblock_free(test);
+	free(test);
 	json_free(json);
 	free(str);
 	fts_close(fts);
@@ -648,12 +1262,459 @@ decode_huffman(const char *name)
 	return (ret);
 }
 
+static int
+field_eq(const struct hpack_field *hf, const char *name, const char *value)
+{
+	return (hf->hpf_name_len == strlen(name) &&
+	    memcmp(hf->hpf_name, name, hf->hpf_name_len) == 0 &&
+	    hf->hpf_value_len == strlen(value) &&
+	    memcmp(hf->hpf_value, value, hf->hpf_value_len) == 0);
+}
+
+static int
+check_refs(void)
+{
+	struct hpack_table		*hpack;
+	struct hpack_block		*hbk = NULL, *hbk2 = NULL, *hbk3;
+	struct hpack_fieldblock		*hfb = NULL;
+	struct hpack_header		*hdr;
+	struct hpack_stats		 hst;
+	unsigned char			 buf[64];
+	ssize_t				 len;
+	int				 ret = -1;
+
+	if ((hpack = hpack_table_new_allocator(0,
+	    &regress_allocator)) == NULL)
+		goto done;
+
+	/* Literal with incremental indexing of custom-key: custom-header */
+	if ((len = parsehex("400a637573746f6d2d6b65790d637573746f6d2d"
+	    "686561646572", buf, sizeof(buf))) == -1 ||
+	    (hbk = hpack_decode_block(buf, len, hpack)) == NULL ||
+	    (hdr = TAILQ_FIRST(&hbk->hbk_headers)) == NULL)
+		goto done;
+
+	/* Modifying a decoded header must not change the table entry */
+	hdr->hdr_value[0] = 'C';
+
+	/* Indexed from the dynamic table into headers and fields */
+	if ((len = parsehex("be", buf, sizeof(buf))) == -1 ||
+	    (hbk2 = hpack_decode_block(buf, len, hpack)) == NULL ||
+	    (hdr = TAILQ_FIRST(&hbk2->hbk_headers)) == NULL ||
+	    strcmp(hdr->hdr_value, "custom-header") != 0 ||
+	    (hfb = hpack_decode_fields(buf, len, hpack)) == NULL ||
+	    hfb->hfb_nfields != 1) {
+		log(1, "decoded header shares the table entry\n");
+		goto done;
+	}
+
+	/* Evict the entry with a table size update and free the table */
+	if ((len = parsehex("20", buf, sizeof(buf))) == -1 ||
+	    (hbk3 = hpack_decode_block(buf, len, hpack)) == NULL)
+		goto done;
+	hpack_block_free(hbk3);
+	hpack_table_stats(hpack, &hst);
+	if (hpack_table_size(hpack) != 0 || hst.hst_evictions != 1) {
+		log(1, "entry not evicted\n");
+		goto done;
+	}
+	hpack_table_free(hpack);
+	hpack = NULL;
+
+	/* The field still references the strings of the evicted entry */
+	if (!field_eq(&hfb->hfb_fields[0], "custom-key", "custom-header")) {
+		log(1, "shared field changed after eviction\n");
+		goto done;
+	}
+	hpack_fieldblock_free(hfb);
+	hpack_block_free(hbk);
+	hpack_block_free(hbk2);
+	hfb = NULL;
+	hbk = hbk2 = NULL;
+	if (regress_allocs != 0) {
+		log(1, "shared strings leaked\n");
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	hpack_fieldblock_free(hfb);
+	hpack_block_free(hbk);
+	hpack_block_free(hbk2);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+check_alloc(void)
+{
+	struct hpack_allocator		 partial = {
+		regress_malloc, NULL, regress_free, &regress_allocs, 0
+	};
+	struct hpack_headerblock	 hdrs;
+	struct hpack_table		*hpack = NULL;
+	struct hpack_decoder		*dec = NULL;
+	unsigned char			 buf[64];
+	ssize_t				 len;
+	int				 ret = -1;
+
+	TAILQ_INIT(&hdrs);
+
+	/* Incomplete sets of hooks are rejected */
+	if (hpack_allocator_set(&partial) != -1 ||
+	    (hpack = hpack_table_new_allocator(0, &partial)) != NULL) {
+		log(1, "incomplete allocator accepted\n");
+		goto done;
+	}
+
+	/* Decode into a header block that is declared by the caller */
+	if ((hpack = hpack_table_new_allocator(0,
+	    &regress_allocator)) == NULL ||
+	    (dec = hpack_decoder_new(hpack)) == NULL ||
+	    (len = parsehex("400a637573746f6d2d6b65790d637573746f6d2d"
+	    "686561646572", buf, sizeof(buf))) == -1 ||
+	    hpack_decoder_feed(dec, buf, len, &hdrs) == -1 ||
+	    hpack_decoder_finish(dec) == -1 ||
+	    TAILQ_FIRST(&hdrs) == NULL) {
+		log(1, "decoding into a caller header block failed\n");
+		goto done;
+	}
+	hpack_headerblock_free(&hdrs);
+	hpack_decoder_free(dec);
+	hpack_table_free(hpack);
+	dec = NULL;
+	hpack = NULL;
+	if (regress_allocs != 0) {
+		log(1, "allocations leaked\n");
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	hpack_headerblock_free(&hdrs);
+	hpack_decoder_free(dec);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+check_lazy(void)
+{
+	struct hpack_fieldblock		*hfb = NULL;
+	struct hpack_table		*hpack = NULL;
+	struct hpack_field		 hf, hfs[2];
+	unsigned char			 buf[64], *wire = NULL;
+	size_t				 wirelen;
+	ssize_t				 len;
+	int				 ret = -1;
+
+	/* Literal value "0" with an invalid padding of zero bits */
+	if ((len = parsehex("0001618100", buf, sizeof(buf))) == -1)
+		goto done;
+	if ((hfb = hpack_decode_fields_lazy(buf, len, NULL)) != NULL) {
+		log(1, "deferred invalid huffman code accepted\n");
+		goto done;
+	}
+
+	/* The same value with a valid padding of one bits */
+	if ((len = parsehex("0001618107", buf, sizeof(buf))) == -1 ||
+	    (hfb = hpack_decode_fields_lazy(buf, len, NULL)) == NULL ||
+	    hfb->hfb_nfields != 1 ||
+	    (hfb->hfb_fields[0].hpf_flags & HPACK_FIELD_HUFFMAN) == 0 ||
+	    hpack_field_decode(hfb, &hfb->hfb_fields[0]) == -1 ||
+	    !field_eq(&hfb->hfb_fields[0], "a", "0")) {
+		log(1, "deferred huffman code rejected\n");
+		goto done;
+	}
+
+	/* Relaying the invalid code as it is must fail */
+	hf.hpf_name = "a";
+	hf.hpf_name_len = 1;
+	hf.hpf_value = "\x00";
+	hf.hpf_value_len = 1;
+	hf.hpf_index = HPACK_NO_INDEX;
+	hf.hpf_token = HPACK_TOKEN_UNKNOWN;
+	hf.hpf_flags = HPACK_FIELD_HUFFMAN;
+	if ((wire = hpack_encode_fields(&hf, 1, &wirelen, NULL)) != NULL) {
+		log(1, "invalid huffman code relayed\n");
+		goto done;
+	}
+
+	/* The field before the invalid code must not be indexed */
+	hfs[0] = hf;
+	hfs[0].hpf_value = "b";
+	hfs[0].hpf_index = HPACK_INDEX;
+	hfs[0].hpf_flags = 0;
+	hfs[1] = hf;
+	if ((hpack = hpack_table_new(4096)) == NULL)
+		goto done;
+	if ((wire = hpack_encode_fields(hfs, 2, &wirelen, hpack)) != NULL ||
+	    hpack_encode_fields_buf(hfs, 2, buf, sizeof(buf),
+	    &wirelen, hpack) != -1 || hpack_table_size(hpack) != 0) {
+		log(1, "table changed by a rejected block\n");
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	free(wire);
+	hpack_fieldblock_free(hfb);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+check_decoder(void)
+{
+	struct hpack_headerblock	 hdrs;
+	struct hpack_header		*hdr;
+	struct hpack_table		*hpack = NULL;
+	struct hpack_decoder		*dec = NULL;
+	unsigned char			 buf[64];
+	ssize_t				 len;
+	size_t				 n;
+	int				 ret = -1;
+
+	TAILQ_INIT(&hdrs);
+
+	/* Literal with a new name that declares a length of 1 MiB */
+	if ((len = parsehex("407f81ff3f", buf, sizeof(buf))) == -1 ||
+	    (dec = hpack_decoder_new(NULL)) == NULL)
+		goto done;
+	if (hpack_decoder_feed(dec, buf, len, &hdrs) != -1) {
+		log(1, "huge field buffered\n");
+		goto done;
+	}
+
+	/* The field is buffered with a larger limit */
+	hpack_decoder_free(dec);
+	if ((dec = hpack_decoder_new(NULL)) == NULL ||
+	    hpack_decoder_setmax(2 * 1024 * 1024, dec) == -1 ||
+	    hpack_decoder_feed(dec, buf, len, &hdrs) == -1 ||
+	    hpack_decoder_finish(dec) != -1) {
+		log(1, "field not buffered\n");
+		goto done;
+	}
+
+	/* Only the missing bytes of a split field are buffered */
+	hpack_decoder_free(dec);
+	for (len = 0; len + 5 <= (ssize_t)sizeof(buf); len += 5)
+		memcpy(buf + len, "\x00\x01\x61\x01\x62", 5);
+	if ((hpack = hpack_table_new_allocator(4096,
+	    &regress_allocator)) == NULL ||
+	    (dec = hpack_decoder_new(hpack)) == NULL)
+		goto done;
+	regress_maxsize = 0;
+	if (hpack_decoder_feed(dec, buf, 2, &hdrs) == -1 ||
+	    hpack_decoder_feed(dec, buf + 2, len - 2, &hdrs) == -1 ||
+	    hpack_decoder_finish(dec) == -1 ||
+	    regress_maxsize >= (size_t)len - 2) {
+		log(1, "fragment buffered\n");
+		goto done;
+	}
+	n = 0;
+	TAILQ_FOREACH(hdr, &hdrs, hdr_entry)
+		n++;
+	if (n != (size_t)len / 5) {
+		log(1, "split fields mismatched\n");
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	hpack_headerblock_free(&hdrs);
+	hpack_decoder_free(dec);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+check_encode(void)
+{
+	struct hpack_headerblock	*hdrs = NULL;
+	struct hpack_header		*hdr;
+	struct hpack_field		 hf;
+	unsigned char			*wire = NULL, buf[256];
+	char				 value[101];
+	size_t				 wirelen, len;
+	int				 ret = -1;
+
+	/* The value is much shorter with the Huffman code */
+	memset(value, 'a', sizeof(value) - 1);
+	value[sizeof(value) - 1] = '\0';
+	if ((hdrs = hpack_headerblock_new()) == NULL ||
+	    hpack_header_add(hdrs, "custom-key", value,
+	    HPACK_NO_INDEX) == NULL ||
+	    (wire = hpack_encode(hdrs, &wirelen, NULL)) == NULL)
+		goto done;
+
+	/* Only the index of the literal might be larger than needed */
+	if (hpack_encode_buf(hdrs, buf, wirelen + 2, &len, NULL) == -1 ||
+	    len != wirelen || memcmp(buf, wire, wirelen) != 0) {
+		log(1, "encoded buffer rejected or mismatched\n");
+		goto done;
+	}
+	if (hpack_encode_buf(hdrs, buf, wirelen - 1, &len, NULL) != -1 ||
+	    len < wirelen || len > wirelen + 2) {
+		log(1, "invalid encoding bound\n");
+		goto done;
+	}
+
+	/* Unknown representations are rejected */
+	hf.hpf_name = "a";
+	hf.hpf_name_len = 1;
+	hf.hpf_value = "b";
+	hf.hpf_value_len = 1;
+	hf.hpf_index = (enum hpack_header_index)(HPACK_INDEX + 1);
+	hf.hpf_token = HPACK_TOKEN_UNKNOWN;
+	hf.hpf_flags = 0;
+	free(wire);
+	if ((wire = hpack_encode_fields(&hf, 1, &len, NULL)) != NULL ||
+	    hpack_encode_fields_buf(&hf, 1, buf, sizeof(buf),
+	    &len, NULL) != -1) {
+		log(1, "invalid field index encoded\n");
+		goto done;
+	}
+	hdr = TAILQ_FIRST(hdrs);
+	hdr->hdr_index = hf.hpf_index;
+	if ((wire = hpack_encode(hdrs, &len, NULL)) != NULL) {
+		log(1, "invalid header index encoded\n");
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	free(wire);
+	hpack_headerblock_free(hdrs);
+	free(hdrs);
+	return (ret);
+}
+
+static int
+policy_encode(struct hpack_table *hpack, const char *name, const char *value,
+    unsigned char *rep)
+{
+	struct hpack_headerblock	*hdrs;
+	unsigned char			*wire = NULL;
+	size_t				 len;
+	int				 ret = -1;
+
+	/* Encode a single header and return its first octet */
+	if ((hdrs = hpack_headerblock_new()) == NULL)
+		return (-1);
+	if (hpack_header_add(hdrs, name, value, HPACK_INDEX) != NULL &&
+	    (wire = hpack_encode(hdrs, &len, hpack)) != NULL && len > 0) {
+		*rep = wire[0];
+		ret = 0;
+	}
+	free(wire);
+	hpack_headerblock_free(hdrs);
+	free(hdrs);
+	return (ret);
+}
+
+static int
+check_policy(void)
+{
+	struct hpack_table		*hpack;
+	struct hpack_stats		 hst;
+	unsigned char			 rep;
+	char				 value[41];
+	int				 i, ret = -1;
+
+	/* Each of the small headers takes 38 of the 128 octets */
+	if ((hpack = hpack_table_new(128)) == NULL ||
+	    hpack_table_setpolicy(HPACK_POLICY_FREQUENCY, hpack) == -1)
+		goto done;
+
+	/* A frequent header is inserted once and indexed afterwards */
+	for (i = 0; i < 4; i++) {
+		if (policy_encode(hpack, "x-hot", "1", &rep) == -1 ||
+		    (i == 0 && (rep & 0xc0) != 0x40) ||
+		    (i > 0 && (rep & 0x80) != 0x80)) {
+			log(1, "frequent header not indexed\n");
+			goto done;
+		}
+	}
+
+	/* Entries larger than half of the table are refused */
+	memset(value, 'v', sizeof(value) - 1);
+	value[sizeof(value) - 1] = '\0';
+	if (policy_encode(hpack, "x-large", value, &rep) == -1 ||
+	    (rep & 0xf0) != 0x00) {
+		log(1, "large header indexed\n");
+		goto done;
+	}
+
+	/* One-off headers fill the free space but don't evict */
+	if (policy_encode(hpack, "x-f1", "1", &rep) == -1 ||
+	    policy_encode(hpack, "x-f2", "1", &rep) == -1 ||
+	    policy_encode(hpack, "x-one", "1", &rep) == -1 ||
+	    (rep & 0xf0) != 0x00) {
+		log(1, "one-off header evicted an entry\n");
+		goto done;
+	}
+	hpack_table_stats(hpack, &hst);
+	if (hst.hst_inserts != 3 || hst.hst_evictions != 0) {
+		log(1, "unexpected inserts %zu evictions %zu\n",
+		    hst.hst_inserts, hst.hst_evictions);
+		goto done;
+	}
+
+	/* A header that is seen more often replaces the oldest entry */
+	for (i = 0; i < 5; i++) {
+		if (policy_encode(hpack, "x-new", "1", &rep) == -1)
+			goto done;
+	}
+	hpack_table_stats(hpack, &hst);
+	if ((rep & 0xc0) != 0x40 ||
+	    hst.hst_inserts != 4 || hst.hst_evictions != 1) {
+		log(1, "frequent header not admitted\n");
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+/* Behavioural checks that are not covered by the samples */
+static const struct check {
+	const char	*c_name;
+	int		 (*c_func)(void);
+} checks[] = {
+	{ "refs",	check_refs },
+	{ "alloc",	check_alloc },
+	{ "lazy",	check_lazy },
+	{ "decoder",	check_decoder },
+	{ "encode",	check_encode },
+	{ "policy",	check_policy },
+};
+
+static int
+run_checks(void)
+{
+	size_t	 i;
+	int	 ret = 0;
+
+	for (i = 0; i < sizeof(checks) / sizeof(checks[0]); i++) {
+		if (checks[i].c_func() == -1) {
+			log(1, "FAILED: check %s\n", checks[i].c_name);
+			ret = -1;
+		} else
+			log(1, "SUCCESS: check %s\n", checks[i].c_name);
+	}
+
+	return (ret);
+}
+
 static __dead void
 usage(void)
 {
 	extern char	*__progname;
 
-	fprintf(stderr, "usage: %s [-d|e file] [-h hex] [-p input-file]"
+	fprintf(stderr, "usage: %s [-c] [-d|e file] [-h hex] [-p input-file]"
 	    " [-r raw-file] [-x hex] [dir ...]\n", __progname);
 	exit(1);
 }
@@ -663,13 +1724,16 @@ main(int argc, char *argv[])
 {
 	const char	*hex = NULL, *input = NULL, *raw = NULL;
 	const char	*huffenc = NULL, *huffdec = NULL;
-	int		 ch, ret;
+	int		 ch, ret, check = 0;
 
 	if (hpack_init() == -1)
 		return (1);
 
-	while ((ch = getopt(argc, argv, "d:Ee:h:i:r:v")) != -1) {
+	while ((ch = getopt(argc, argv, "cd:Ee:h:i:r:v")) != -1) {
 		switch (ch) {
+		case 'c':
+			check = 1;
+			break;
 		case 'd':
 			huffdec = optarg;
 			break;
@@ -698,12 +1762,14 @@ main(int argc, char *argv[])
 	argc -= optind;
 	argv += optind;
 
-	if (huffdec != NULL)
+	if (check)
+		ret = run_checks();
+	else if (huffdec != NULL)
 		ret = decode_huffman(huffdec);
 	else if (huffenc != NULL)
 		ret = encode_huffman(huffenc);
 	else if (hex != NULL)
-		ret = parse_hex(hex, NULL, NULL);
+		ret = parse_hex(hex, NULL, NULL, NULL);
 	else if (input != NULL)
 		ret = parse_input(input, 4096);
 	else if (raw != NULL)